@@ -0,0 +1,56 @@
+// CompiledSpell: flat, pre-resolved execution plan built from a Spell or SpellTemplate
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+#include "spellengine/spell_component.hpp"
+#include "spellengine/executor_base.hpp"
+#include <vector>
+
+using namespace godot;
+
+class CompiledSpell : public RefCounted {
+    GDCLASS(CompiledSpell, RefCounted)
+
+protected:
+    static void _bind_methods();
+
+public:
+    // One plan step per valid component, in the original component order.
+    struct Step {
+        Ref<SpellComponent> component;
+        // Executor resolved from the ExecutorRegistry at compile time (null if unregistered)
+        Ref<IExecutor> executor;
+        String executor_id;
+        // Index of the component in the source components array
+        int source_index = 0;
+        // Control-only components (choose_/select_) are resolved interactively
+        bool is_control = false;
+    };
+
+private:
+    std::vector<Step> steps;
+    // Source component pointers, used to detect when the plan no longer matches its spell
+    std::vector<const SpellComponent *> source_components;
+    // ExecutorRegistry revision observed at compile time
+    uint64_t registry_revision = 0;
+    int first_control_index = -1;
+
+public:
+    // Heuristic shared by the engine and plan: control executors start with choose_ or select_
+    static bool is_control_executor_id(const String &exec_id);
+
+    // Build the plan from an ordered component list, resolving executors from the registry.
+    void compile(const TypedArray<Ref<SpellComponent>> &components);
+    // True if the plan was compiled from exactly these components against the current registry.
+    bool is_current_for(const TypedArray<Ref<SpellComponent>> &components) const;
+
+    const std::vector<Step> &get_steps() const { return steps; }
+    int get_step_count() const;
+    // Number of entries in the source components array (including invalid ones)
+    int get_source_component_count() const;
+    // Source index of the first control component, or -1 if the plan has none
+    int get_first_control_index() const;
+    // Executor ids in plan order (debugging / editor tooling)
+    Array get_executor_ids() const;
+};
@@ -0,0 +1,57 @@
+// DamageAccumulator: coalesces damage hits per target and delivers them in one call
+#pragma once
+
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+// Hits added inside a batch scope are grouped by target in arrival order and delivered when
+// the outermost scope closes: targets implementing apply_damage_batch(packets) get a single
+// call with an Array of { "amount", "aspect", "meta" } packets, other targets get one
+// apply_damage(amount, aspect, meta) per hit, and SpellTargets get direct native calls.
+// SpellTargets are queued like any other target so every target sees a cast's damage at the
+// same point. Outside any scope hits are delivered at once.
+// SpellEngine opens a scope per cast and per batch call, StatusEffectServer per tick pass;
+// game code can widen it to a whole frame with SpellEngine.begin/end_damage_batch().
+// Main thread only.
+class DamageAccumulator {
+    struct Hit {
+        double amount;
+        String aspect;
+        Dictionary meta;
+    };
+    struct TargetHits {
+        uint64_t target_id;
+        std::vector<Hit> hits;
+    };
+
+    static int depth;
+    static std::vector<TargetHits> pending;
+    // target instance id -> index into pending
+    static std::unordered_map<uint64_t, size_t> pending_index;
+
+    static void deliver(Object *obj, const std::vector<Hit> &hits);
+
+public:
+    static void add_hit(Object *target, double amount, const String &aspect, const Dictionary &meta);
+
+    static void begin();
+    // Closes a scope; the outermost end() flushes
+    static void end();
+    static void flush();
+    static int get_depth() { return depth; }
+    static int get_pending_target_count() { return (int)pending.size(); }
+};
+
+class DamageBatchScope {
+public:
+    DamageBatchScope() { DamageAccumulator::begin(); }
+    ~DamageBatchScope() { DamageAccumulator::end(); }
+    DamageBatchScope(const DamageBatchScope &) = delete;
+    DamageBatchScope &operator=(const DamageBatchScope &) = delete;
+};
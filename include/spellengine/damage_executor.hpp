@@ -12,7 +12,14 @@ protected:
     static void _bind_methods();
 
 public:
+    // Typed params decoded from the resolved ParamBlock; initializers are the schema defaults
+    struct Params {
+        double amount = 0.0;
+        String aspect;
+    };
+
     virtual void execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) override;
+    virtual void execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) override;
     virtual String get_executor_id() const override;
     virtual Dictionary get_param_schema() const override;
 };
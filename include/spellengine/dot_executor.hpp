@@ -1,4 +1,4 @@
-// DOT executor: applies a StatusEffect to targets
+// DOT executor: registers ticking damage effects on targets with the StatusEffectServer
 #pragma once
 
 #include "executor_base.hpp"
@@ -12,7 +12,19 @@ protected:
     static void _bind_methods();
 
 public:
+    // Typed params decoded from the resolved ParamBlock; initializers are the schema defaults
+    struct Params {
+        double amount_per_tick = 0.0;
+        double tick_interval = 1.0;
+        double duration = 5.0;
+        String aspect;
+        // Stacking per (target, aspect, triggering component); see StatusEffectServer::StackPolicy
+        String stack_policy = "independent";
+        int64_t max_stacks = 0;
+    };
+
     virtual void execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) override;
+    virtual void execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) override;
     virtual String get_executor_id() const override;
     virtual Dictionary get_param_schema() const override;
 };
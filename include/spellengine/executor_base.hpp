@@ -5,6 +5,7 @@
 #include <godot_cpp/variant/dictionary.hpp>
 #include "spellengine/spell_context.hpp"
 #include "spellengine/spell_component.hpp"
+#include "spellengine/param_block.hpp"
 
 using namespace godot;
 
@@ -17,6 +18,12 @@ protected:
 public:
     virtual void execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) = 0;
 
+    // Native entry point used by SpellEngine. Executors that read their params natively
+    // override this and forward execute() to it; the default converts to a Dictionary.
+    virtual void execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {
+        execute(ctx, component, params.to_dictionary());
+    }
+
     // Each executor must provide its own id. This allows executors to self-identify
     // and be auto-registered by the module initialization code.
     virtual String get_executor_id() const = 0;
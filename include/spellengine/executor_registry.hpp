@@ -19,6 +19,8 @@ protected:
 private:
     // map executor id -> executor instance
     Dictionary executors;
+    // bumped whenever the executor set changes so compiled spell plans can detect staleness
+    uint64_t revision = 0;
     static ExecutorRegistry *singleton;
 
 public:
@@ -30,6 +32,7 @@ public:
     Array get_executor_ids() const;
     bool has_executor(const String &id) const;
     Ref<IExecutor> get_executor(const String &id) const;
+    uint64_t get_revision() const;
 
     // Register a factory for an executor. Factories are stored and later
     // instantiated during module init via register_all_factories(). This allows
@@ -0,0 +1,34 @@
+// InertRegistry: native activation state of spawned-but-not-yet-launched summons
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <cstdint>
+#include <unordered_map>
+
+using namespace godot;
+
+// Summons are spawned inert and activated by the first force applied to them. A RigidBody3D
+// is parked with its own freeze property, so the node, its freeze_mode and later freeze or
+// lock_rotation edits all agree with the physics server; the freeze state authored in the
+// scene is remembered here and restored on activation. Other nodes simply have physics
+// processing turned off. Entries of freed nodes are pruned as the table grows. Main thread only.
+class InertRegistry {
+    struct Entry {
+        bool body = false;
+        // Authored RigidBody3D::freeze restored on activation; only meaningful for bodies
+        bool authored_freeze = false;
+    };
+    static std::unordered_map<uint64_t, Entry> entries;
+    static size_t prune_at;
+
+    static void prune();
+    static void restore(Node *node, const Entry &e);
+
+public:
+    static void mark(Node *node);
+    static bool is_inert(uint64_t instance_id);
+    // Restore physics for an inert node; false if it was not inert.
+    static bool activate(Node *node);
+    static int get_count() { return (int)entries.size(); }
+    static void clear() { entries.clear(); }
+};
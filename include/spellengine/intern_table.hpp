@@ -0,0 +1,49 @@
+// InternTable: maps strings (aspect ids, parameter keys) to small dense integer ids
+#pragma once
+
+#include <godot_cpp/variant/string.hpp>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+using namespace godot;
+
+// Thread-safe: exported setters of SpellCaster/SpellTarget intern while SummonSpawnQueue
+// instantiates scenes on worker threads, concurrently with casts on the main thread.
+// Lookups take a shared lock and only new names take the exclusive one. Names are kept in
+// fixed chunks that never move, so get_name() reads without locking.
+class InternTable {
+    struct StringHasher {
+        size_t operator()(const String &s) const { return (size_t)s.hash(); }
+    };
+
+    static constexpr int CHUNK_BITS = 8;
+    static constexpr int CHUNK_SIZE = 1 << CHUNK_BITS;
+    static constexpr int MAX_CHUNKS = 4096;
+
+    mutable std::shared_mutex lock;
+    std::unordered_map<String, int, StringHasher> ids;
+    std::unique_ptr<String[]> chunks[MAX_CHUNKS];
+    std::atomic<int> count{ 0 };
+    // Case-insensitive tables key ids by the lowercase form; other spellings are cached as aliases
+    bool fold_case = false;
+
+    int find_locked(const String &name) const;
+
+public:
+    explicit InternTable(bool p_fold_case = false) : fold_case(p_fold_case) {}
+
+    // Return the id for `name`, assigning the next free id if it is new.
+    int intern(const String &name);
+    // Return the id for `name`, or -1 if it was never interned.
+    int find(const String &name) const;
+    // Canonical name for an id (lowercase in case-insensitive tables)
+    const String &get_name(int id) const { return chunks[id >> CHUNK_BITS][id & (CHUNK_SIZE - 1)]; }
+    int size() const { return count.load(std::memory_order_acquire); }
+
+    // Process-wide tables. Ids are never reused. Aspect ids are case-insensitive (shared by
+    // SpellCaster, SpellTarget and SynergyRegistry); parameter keys are case-sensitive.
+    static InternTable &aspects();
+    static InternTable &params();
+};
@@ -0,0 +1,72 @@
+// MultiMeshBatcher: draws homogeneous spell visuals through one MultiMeshInstance3D per mesh
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/multi_mesh.hpp>
+#include <godot_cpp/classes/multi_mesh_instance3d.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+// One node under the SceneTree root owns a MultiMeshInstance3D per distinct Mesh. Two kinds
+// of instances feed a batch:
+//  - tracked MeshInstance3D nodes (mass summons): the node is hidden and its global transform
+//    is copied into the batch every frame while it is inside the tree;
+//  - native transforms published by a server (ProjectileServer) with set_transforms(), which
+//    replace that mesh's previous native set.
+// Each frame the transforms are packed into one float buffer and uploaded with set_buffer,
+// so draw calls scale with the number of meshes rather than instances. Main thread only.
+class MultiMeshBatcher : public Node {
+    GDCLASS(MultiMeshBatcher, Node)
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct Batch {
+        Ref<Mesh> mesh;
+        Ref<MultiMesh> multimesh;
+        MultiMeshInstance3D *node = nullptr;
+        // Hidden MeshInstance3D nodes drawn through this batch
+        std::vector<uint64_t> tracked_ids;
+        std::vector<Transform3D> native;
+        PackedFloat32Array buffer;
+        // instance_count of the MultiMesh (grown in powers of two, never shrunk)
+        int capacity = 0;
+    };
+    // keyed by the Mesh's instance id
+    std::unordered_map<uint64_t, Batch> batches;
+    static MultiMeshBatcher *singleton;
+
+    Batch &batch_for(const Ref<Mesh> &mesh);
+    void upload(Batch &batch);
+
+public:
+    MultiMeshBatcher();
+    ~MultiMeshBatcher();
+
+    // Existing batcher, or a new one queued for addition under the SceneTree root (null without a SceneTree)
+    static MultiMeshBatcher *get_singleton();
+
+    void _process(double delta) override;
+
+    // Draw node (or its first MeshInstance3D descendant) through its mesh's batch. Idempotent;
+    // returns false if no MeshInstance3D with a mesh was found.
+    bool track_node(Node *node);
+    // Stop batching node's mesh instance and show it again.
+    void untrack_node(Node *node);
+    // Replace the native instance transforms drawn with mesh.
+    void set_transforms(const Ref<Mesh> &mesh, const std::vector<Transform3D> &transforms);
+    // Rebuild and upload every batch now (normally done each frame).
+    void flush();
+    void clear();
+
+    int get_batch_count() const;
+    // Instances drawn by mesh's batch at the last upload
+    int get_visible_count(const Ref<Mesh> &mesh) const;
+};
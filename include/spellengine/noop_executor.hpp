@@ -0,0 +1,18 @@
+// Noop executor: resolves like any executor but has no side effects (benchmarks, placeholders)
+#pragma once
+
+#include "spellengine/executor_base.hpp"
+
+using namespace godot;
+
+class NoopExecutor : public IExecutor {
+    GDCLASS(NoopExecutor, IExecutor)
+
+protected:
+    static void _bind_methods();
+
+public:
+    virtual void execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) override;
+    virtual void execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) override;
+    virtual String get_executor_id() const override;
+};
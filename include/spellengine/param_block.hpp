@@ -0,0 +1,79 @@
+// ParamBlock: inline typed parameter set passed between SpellEngine and native executors
+#pragma once
+
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/variant.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+using namespace godot;
+
+// Keys are ids from InternTable::params(). Numbers, bools and vectors are stored unboxed;
+// anything else (strings, resources, arrays) is kept as a Variant. The first
+// INLINE_CAPACITY entries live inside the block, so typical component params never allocate.
+// Converted to a Dictionary only when crossing into GDScript.
+class ParamBlock {
+public:
+    enum Type : uint8_t {
+        TYPE_BOOL,
+        TYPE_INT,
+        TYPE_FLOAT,
+        TYPE_VECTOR2,
+        TYPE_VECTOR3,
+        TYPE_VARIANT,
+    };
+    static constexpr int INLINE_CAPACITY = 8;
+
+private:
+    struct Entry {
+        int key = -1;
+        Type type = TYPE_VARIANT;
+        union {
+            bool b;
+            int64_t i;
+            double f;
+        } num = {};
+        Vector3 vec;
+        Variant other;
+    };
+
+    Entry inline_entries[INLINE_CAPACITY];
+    std::vector<Entry> overflow;
+    int count = 0;
+
+    const Entry *find_entry(int key) const;
+    Entry &entry_for_write(int key);
+    static Variant entry_value(const Entry &e);
+
+public:
+    // Intern a parameter key. Executors cache these ids in function statics.
+    static int key(const String &name);
+
+    int size() const { return count; }
+    bool has(int key) const { return find_entry(key) != nullptr; }
+    bool has(const String &name) const;
+    void clear();
+
+    void set_bool(int key, bool value);
+    void set_int(int key, int64_t value);
+    void set_float(int key, double value);
+    void set_vector3(int key, const Vector3 &value);
+    // Stores value in the narrowest typed slot that fits its Variant type.
+    void set(int key, const Variant &value);
+    void set(const String &name, const Variant &value) { set(ParamBlock::key(name), value); }
+
+    // Typed getters coerce between numeric types and return `def` when the key is missing
+    // or holds an incompatible type.
+    bool get_bool(int key, bool def = false) const;
+    int64_t get_int(int key, int64_t def = 0) const;
+    double get_float(int key, double def = 0.0) const;
+    Vector3 get_vector3(int key, const Vector3 &def = Vector3()) const;
+    String get_string(int key, const String &def = String()) const;
+    Variant get(int key, const Variant &def = Variant()) const;
+
+    // Overwrites/adds every entry of `values` (used for synergy params_mods).
+    void merge_dictionary(const Dictionary &values);
+    static ParamBlock from_dictionary(const Dictionary &values);
+    Dictionary to_dictionary() const;
+};
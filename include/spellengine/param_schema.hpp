@@ -0,0 +1,155 @@
+// ParamSchema: compile-time executor parameter declarations (editor schema + typed decode)
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include "spellengine/param_block.hpp"
+#include <array>
+#include <tuple>
+
+using namespace godot;
+
+// An executor declares a plain params struct whose in-class initializers are the
+// defaults, plus one ParamSchema listing its fields:
+//
+//   static constexpr auto SCHEMA = make_param_schema<MyExecutor::Params>(
+//       param_field("amount", &MyExecutor::Params::amount, "Amount of damage to apply"));
+//
+// SCHEMA.to_dictionary() produces the get_param_schema() Dictionary and
+// SCHEMA.decode(block) fills a Params from a ParamBlock, reading each field once.
+
+// Per-type schema name, decode and default export. Missing or mismatched values keep the default.
+template <typename T>
+struct ParamTraits;
+
+template <>
+struct ParamTraits<double> {
+    static constexpr const char *type_name = "float";
+    static void decode(const ParamBlock &block, int key, double &out) { out = block.get_float(key, out); }
+    static Variant to_variant(double v) { return v; }
+};
+
+template <>
+struct ParamTraits<int64_t> {
+    static constexpr const char *type_name = "int";
+    static void decode(const ParamBlock &block, int key, int64_t &out) { out = block.get_int(key, out); }
+    static Variant to_variant(int64_t v) { return v; }
+};
+
+template <>
+struct ParamTraits<bool> {
+    static constexpr const char *type_name = "bool";
+    static void decode(const ParamBlock &block, int key, bool &out) { out = block.get_bool(key, out); }
+    static Variant to_variant(bool v) { return v; }
+};
+
+template <>
+struct ParamTraits<String> {
+    static constexpr const char *type_name = "string";
+    static void decode(const ParamBlock &block, int key, String &out) { out = block.get_string(key, out); }
+    static Variant to_variant(const String &v) { return v; }
+};
+
+// Vectors accept a Vector3 or an [x, y, z] array and are exported to the editor as arrays.
+template <>
+struct ParamTraits<Vector3> {
+    static constexpr const char *type_name = "array";
+    static void decode(const ParamBlock &block, int key, Vector3 &out) {
+        if (!block.has(key)) return;
+        Variant v = block.get(key);
+        if (v.get_type() == Variant::VECTOR3) {
+            out = v;
+        } else if (v.get_type() == Variant::ARRAY) {
+            Array a = v;
+            double x = 0.0, y = 0.0, z = 0.0;
+            if (a.size() >= 1) x = (double)a[0];
+            if (a.size() >= 2) y = (double)a[1];
+            if (a.size() >= 3) z = (double)a[2];
+            out = Vector3((float)x, (float)y, (float)z);
+        }
+    }
+    static Variant to_variant(const Vector3 &v) {
+        Array a;
+        a.append(v.x);
+        a.append(v.y);
+        a.append(v.z);
+        return a;
+    }
+};
+
+template <typename T>
+struct ParamTraits<Ref<T>> {
+    static constexpr const char *type_name = "object";
+    static void decode(const ParamBlock &block, int key, Ref<T> &out) {
+        Variant v = block.get(key);
+        if (v.get_type() != Variant::OBJECT) return;
+        T *obj = Object::cast_to<T>(v);
+        if (obj) out = Ref<T>(obj);
+    }
+    static Variant to_variant(const Ref<T> &v) { return v.is_valid() ? Variant(v) : Variant(); }
+};
+
+template <typename P, typename T>
+struct ParamField {
+    const char *name;
+    T P::*member;
+    const char *desc;
+};
+
+template <typename P, typename T>
+constexpr ParamField<P, T> param_field(const char *name, T P::*member, const char *desc) {
+    return ParamField<P, T>{ name, member, desc };
+}
+
+template <typename P, typename... Fields>
+class ParamSchema {
+    std::tuple<Fields...> fields;
+
+    template <typename T>
+    static void add_entry(Dictionary &schema, const P &defaults, const ParamField<P, T> &f) {
+        Dictionary e;
+        e["type"] = ParamTraits<T>::type_name;
+        e["default"] = ParamTraits<T>::to_variant(defaults.*(f.member));
+        e["desc"] = String(f.desc);
+        schema[String(f.name)] = e;
+    }
+
+    template <typename T>
+    static void decode_field(const ParamBlock &block, int key, P &out, const ParamField<P, T> &f) {
+        ParamTraits<T>::decode(block, key, out.*(f.member));
+    }
+
+    // Key ids are interned on first decode (main thread); one schema per params struct.
+    const std::array<int, sizeof...(Fields)> &key_ids() const {
+        static const std::array<int, sizeof...(Fields)> ids = std::apply(
+                [](const auto &...f) { return std::array<int, sizeof...(Fields)>{ ParamBlock::key(f.name)... }; }, fields);
+        return ids;
+    }
+
+public:
+    constexpr explicit ParamSchema(Fields... f) :
+            fields(f...) {}
+
+    // Editor-facing schema: key -> { "type", "default", "desc" }; defaults come from P's initializers.
+    Dictionary to_dictionary() const {
+        Dictionary schema;
+        const P defaults{};
+        std::apply([&](const auto &...f) { (add_entry(schema, defaults, f), ...); }, fields);
+        return schema;
+    }
+
+    P decode(const ParamBlock &block) const {
+        P out{};
+        const std::array<int, sizeof...(Fields)> &ids = key_ids();
+        size_t i = 0;
+        std::apply([&](const auto &...f) { (decode_field(block, ids[i++], out, f), ...); }, fields);
+        return out;
+    }
+};
+
+template <typename P, typename... Fields>
+constexpr ParamSchema<P, Fields...> make_param_schema(Fields... f) {
+    return ParamSchema<P, Fields...>(f...);
+}
@@ -0,0 +1,48 @@
+// Projectile executor: launches native projectiles on the ProjectileServer (no node per projectile)
+#pragma once
+
+#include "spellengine/executor_base.hpp"
+#include "spellengine/spell.hpp"
+#include "spellengine/spell_template.hpp"
+#include <godot_cpp/classes/mesh.hpp>
+#include <cstdint>
+#include <unordered_map>
+
+using namespace godot;
+
+class ProjectileExecutor : public IExecutor {
+    GDCLASS(ProjectileExecutor, IExecutor)
+
+protected:
+    static void _bind_methods();
+
+private:
+    // One Spell per impact_template (by template instance id), so its compiled plan and the
+    // engine's resolution cache survive across casts. Entries of freed templates are pruned on miss.
+    std::unordered_map<uint64_t, Ref<Spell>> template_spells;
+    Ref<Spell> get_template_spell(const Ref<SpellTemplate> &tmpl);
+
+public:
+    // Typed params decoded from the resolved ParamBlock; initializers are the schema defaults
+    struct Params {
+        Vector3 position;
+        bool position_from_caster = true;
+        Vector3 offset;
+        Vector3 direction = Vector3(0, 0, -1);
+        double speed = 20.0;
+        int64_t count = 1;
+        double spread = 0.0;
+        Vector3 gravity = Vector3(0, -9.8, 0);
+        double radius = 0.25;
+        double lifetime = 5.0;
+        int64_t collision_mask = 0xFFFFFFFF;
+        Ref<Spell> impact_spell;
+        Ref<SpellTemplate> impact_template;
+        Ref<Mesh> mesh;
+    };
+
+    virtual void execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) override;
+    virtual void execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) override;
+    virtual String get_executor_id() const override;
+    virtual Dictionary get_param_schema() const override;
+};
@@ -0,0 +1,125 @@
+// ProjectileServer: simulates ballistic projectiles natively from packed per-projectile arrays
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/physics_direct_space_state3d.hpp>
+#include <godot_cpp/classes/physics_ray_query_parameters3d.hpp>
+#include <godot_cpp/classes/physics_shape_query_parameters3d.hpp>
+#include <godot_cpp/classes/sphere_shape3d.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/rid.hpp>
+#include "spellengine/spell.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+class SpellEngine;
+
+// Projectiles are not nodes: one node under the SceneTree root keeps their state as
+// parallel arrays and integrates them in a single _physics_process pass. Each step's
+// segment is swept against the main World3D (a ray for radius 0, otherwise a sphere
+// cast_motion) with one reused query object; impacts are collected during the pass and
+// dispatched afterwards inside one DamageAccumulator batch: projectile_hit is emitted and
+// the projectile's impact spell runs with the collider as target and the impact point in
+// results.chosen_position / impact_position / impact_normal.
+//
+// Impact spells run on the engine given to set_impact_engine() (normally the game's casting
+// engine, so its merge modes, multipliers and cache settings apply). Without one, or once it
+// is freed, a default-configured engine owned by the server is used.
+//
+// Projectiles spawned with a mesh are drawn through the MultiMeshBatcher: after each pass
+// their transforms (facing along the velocity) are published per mesh.
+class ProjectileServer : public Node {
+    GDCLASS(ProjectileServer, Node)
+
+protected:
+    static void _bind_methods();
+
+private:
+    static ProjectileServer *singleton;
+
+    // Per-projectile columns, index-aligned; removal swaps with the last entry
+    std::vector<int64_t> handles;
+    std::vector<Vector3> positions;
+    std::vector<Vector3> velocities;
+    std::vector<Vector3> gravities;
+    std::vector<float> radii;
+    std::vector<double> remaining;
+    std::vector<uint32_t> collision_masks;
+    std::vector<uint64_t> caster_ids;
+    // Collision RID of the caster's nearest CollisionObject3D (excluded from the sweep), invalid if none
+    std::vector<RID> caster_rids;
+    std::vector<Ref<Spell>> impact_spells;
+    std::vector<Dictionary> metadata;
+    // Visual drawn through the MultiMeshBatcher (null for invisible projectiles)
+    std::vector<Ref<Mesh>> meshes;
+
+    struct PendingImpact {
+        int64_t handle;
+        uint64_t collider_id;
+        Vector3 position;
+        Vector3 normal;
+        uint64_t caster_id;
+        Ref<Spell> spell;
+        Dictionary meta;
+    };
+    std::vector<PendingImpact> pending_impacts;
+    std::vector<int64_t> pending_expired;
+
+    std::unordered_map<int64_t, size_t> handle_index;
+    int64_t next_handle = 1;
+    bool paused = false;
+
+    // Reused sweep objects (created on first use)
+    Ref<PhysicsRayQueryParameters3D> ray_query;
+    Ref<PhysicsShapeQueryParameters3D> shape_query;
+    Ref<SphereShape3D> sphere;
+    RID last_excluded;
+    // Engine set by the game for impact spells (0 = none), and the server-owned fallback
+    uint64_t impact_engine_id = 0;
+    SpellEngine *default_impact_engine = nullptr;
+
+    // Meshes published to the batcher by the last pass (so emptied ones get cleared)
+    std::vector<Ref<Mesh>> published_meshes;
+
+    void remove_at(size_t index);
+    void publish_visuals();
+    void set_excluded(const RID &rid);
+    // Sweep index i from its position by motion; fills the impact and returns true on a hit.
+    bool sweep(PhysicsDirectSpaceState3D *space, size_t i, const Vector3 &motion, PendingImpact &out);
+    void dispatch();
+
+public:
+    ProjectileServer();
+    ~ProjectileServer();
+
+    // Existing server, or a new one queued for addition under the SceneTree root (null without a SceneTree)
+    static ProjectileServer *get_singleton();
+
+    void _physics_process(double delta) override;
+
+    // Start a projectile; it flies until it hits something in collision_mask or lifetime runs out.
+    // caster (or the body it sits under) is excluded from hits; caster becomes the impact context's caster. Returns a handle.
+    int64_t spawn(const Vector3 &origin, const Vector3 &velocity, double lifetime, double radius, const Vector3 &gravity, int64_t collision_mask, Node *caster, const Ref<Spell> &impact_spell, const Dictionary &meta, const Ref<Mesh> &mesh);
+    bool remove(int64_t handle);
+    void clear();
+
+    int get_count() const;
+    bool has_projectile(int64_t handle) const;
+    Vector3 get_position(int64_t handle) const;
+    Vector3 get_velocity(int64_t handle) const;
+
+    // Integrate all projectiles by delta seconds, sweep for hits and dispatch impacts.
+    // Without a physics space (no World3D) projectiles move and expire but never hit.
+    void advance(double delta);
+
+    void set_paused(bool p_paused);
+    bool is_paused() const;
+
+    // Engine that runs impact spells (null restores the server's default engine)
+    void set_impact_engine(SpellEngine *engine);
+    SpellEngine *get_impact_engine() const;
+};
@@ -0,0 +1,59 @@
+// SceneCache: path -> PackedScene cache with background preloading for summons
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <unordered_map>
+
+using namespace godot;
+
+class SpellComponent;
+
+// Holds strong references to summon scenes so the cast path is a hash lookup instead of a
+// ResourceLoader::load(). Scenes referenced by registered components (base_params.scene_path)
+// are requested with load_threaded_request when the component is registered; a cast that needs
+// a scene still in flight waits for that load rather than starting another. Main thread only.
+class SceneCache : public Object {
+    GDCLASS(SceneCache, Object)
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct StringHasher {
+        size_t operator()(const String &s) const { return (size_t)s.hash(); }
+    };
+    struct Entry {
+        Ref<PackedScene> scene;
+        // load_threaded_request() issued and not yet collected
+        bool pending = false;
+        // load failed or the resource is not a PackedScene; not retried until clear()
+        bool failed = false;
+    };
+    std::unordered_map<String, Entry, StringHasher> entries;
+    int64_t hits = 0;
+    int64_t misses = 0;
+    static SceneCache *singleton;
+
+    void collect(const String &path, Entry &e, bool block);
+
+public:
+    static SceneCache *get_singleton();
+    static void shutdown();
+
+    // Start a background load of path unless it is cached or already in flight.
+    void preload(const String &path);
+    // Preload the component's base_params.scene_path, if it has one.
+    void preload_component(const Ref<SpellComponent> &component);
+    // Cached scene for path, loading (or waiting for a preload) on first use. Null on failure.
+    Ref<PackedScene> get_scene(const String &path);
+    // True once path has been loaded into the cache (collects finished preloads without waiting).
+    bool is_cached(const String &path);
+    // Collect every finished background load without blocking; returns how many were collected.
+    int poll();
+    // { cached, pending, hits, misses }
+    Dictionary get_stats() const;
+    void clear();
+};
@@ -0,0 +1,58 @@
+// ScenePool: per-PackedScene pools of reusable summon instances
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+// Instances handed out by acquire() remember their pool; release() detaches them from the tree
+// and keeps them for reuse (up to the pool's cap, beyond which they are freed). Reused
+// instances get their transform, physics state and inert state reset and, when the
+// scene's script defines it, on_pool_acquire() called. Main thread only.
+class ScenePool : public Object {
+    GDCLASS(ScenePool, Object)
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct Pool {
+        Ref<PackedScene> scene;
+        // Detached instances ready for reuse (instance ids)
+        std::vector<uint64_t> free_ids;
+        int cap = 32;
+        int64_t created = 0;
+        int64_t reused = 0;
+    };
+    // keyed by the PackedScene's instance id
+    std::unordered_map<uint64_t, Pool> pools;
+    static ScenePool *singleton;
+
+    Pool &pool_for(const Ref<PackedScene> &scene);
+    Node *instantiate_into(Pool &pool);
+    static void reset_instance(Node *inst);
+    void _detach(int64_t instance_id);
+
+public:
+    static ScenePool *get_singleton();
+    // Frees pooled instances and the singleton (module shutdown)
+    static void shutdown();
+
+    // Set the pool's cap and instantiate detached instances until warm_size are free.
+    void configure(const Ref<PackedScene> &scene, int warm_size, int cap);
+    bool has_pool(const Ref<PackedScene> &scene) const;
+    // Reused instance if one is free, otherwise a new one. Not added to the tree.
+    Node *acquire(const Ref<PackedScene> &scene);
+    // Returns a pooled instance; false if inst was not created by a pool (caller frees it).
+    bool release(Node *inst);
+    int get_free_count(const Ref<PackedScene> &scene) const;
+    // { scene path: { free, cap, created, reused } }
+    Dictionary get_stats() const;
+    void clear();
+};
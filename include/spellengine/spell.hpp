@@ -5,6 +5,7 @@
 #include <godot_cpp/variant/typed_array.hpp>
 #include "spellengine/spell_component.hpp"
 #include "spellengine/spell_context.hpp"
+#include "spellengine/compiled_spell.hpp"
 
 using namespace godot;
 
@@ -17,6 +18,8 @@ protected:
 private:
     TypedArray<Ref<SpellComponent>> components;
     String source_template = "";
+    // Cached execution plan; cleared whenever the component list is replaced
+    Ref<CompiledSpell> compiled_plan;
 
 public:
     void set_components(const TypedArray<Ref<SpellComponent>> &p_components);
@@ -25,6 +28,10 @@ public:
     void set_source_template(const String &p);
     String get_source_template() const;
 
+    // Cached compiled plan (managed by SpellEngine::compile_spell)
+    Ref<CompiledSpell> get_compiled_plan() const;
+    void set_compiled_plan(const Ref<CompiledSpell> &p_plan);
+
     // Execute the spell using a SpellContext
     void execute(Ref<SpellContext> ctx);
 };
@@ -4,6 +4,7 @@
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/array.hpp>
+#include <vector>
 
 using namespace godot;
 
@@ -14,14 +15,26 @@ protected:
     static void _bind_methods();
 
 private:
-    // aspect_id -> mana amount
-    Dictionary aspect_mana;
+    // Mana pools indexed by interned aspect id (InternTable::aspects()).
+    // mana_present distinguishes an explicit 0.0 from an aspect that was never set.
+    std::vector<double> mana;
+    std::vector<uint8_t> mana_present;
     // assigned aspects (Array of String ids)
     Array assigned_aspects;
-    // aspect_id -> Dictionary(scaler_key -> numeric multiplier)
-    Dictionary aspect_scalers;
+    // Scalers indexed [aspect id][param id] (InternTable::params()); NaN marks unset entries
+    std::vector<std::vector<double>> scalers;
     // Scaler merge mode used when applying defaults from Aspect resources
     int scaler_merge_mode = 0; // 0=overwrite,1=add,2=multiply,3=min,4=max
+    // bumped whenever aspect_scalers change (used by SpellEngine's resolution cache)
+    uint64_t scaler_version = 0;
+    // Aspect ids are case-insensitive; this keeps the spelling last written for each id so
+    // aspect_mana/aspect_scalers export the authored key ("Fire") instead of the folded one.
+    std::vector<String> aspect_spellings;
+
+    void ensure_mana_slot(int aspect_id);
+    // Intern aspect and remember its spelling for export
+    int author_aspect(const String &aspect);
+    const String &get_aspect_spelling(int aspect_id) const;
 
 public:
     // Mana accessors
@@ -30,7 +43,16 @@ public:
     void add_mana(const String &aspect, double amount);
     bool can_deduct(const String &aspect, double amount) const;
     bool deduct_mana(const String &aspect, double amount);
-    // Whole-map accessors (for serialization / editor)
+    // Indexed mana check/deduction for the cast loop; ids come from InternTable::aspects()
+    // (interned by the caller, so a valid id is always >= 0).
+    bool can_deduct_by_id(int aspect_id, double amount) const {
+        double cur = 0.0;
+        if (aspect_id >= 0 && aspect_id < (int)mana.size() && mana_present[aspect_id]) cur = mana[aspect_id];
+        return cur >= amount - 1e-9;
+    }
+    bool deduct_mana_by_id(int aspect_id, double amount);
+    // Whole-map accessors (for serialization / editor). These build and import
+    // Dictionary views of the dense storage; edits to a returned Dictionary do not write back.
     Dictionary get_aspect_mana() const;
     void set_aspect_mana(const Dictionary &m);
 
@@ -43,6 +65,25 @@ public:
     void set_aspect_scalers(const Dictionary &s);
     double get_scaler(const String &aspect, const String &key) const;
     void set_scaler(const String &aspect, const String &key, double value);
+    // Indexed read for the composition inner loop; ids come from InternTable. Returns 1.0 if unset.
+    double get_scaler_by_id(int aspect_id, int param_id) const {
+        if (aspect_id < 0 || param_id < 0 || aspect_id >= (int)scalers.size()) return 1.0;
+        const std::vector<double> &row = scalers[aspect_id];
+        if (param_id >= (int)row.size() || row[param_id] != row[param_id]) return 1.0;
+        return row[param_id];
+    }
     int get_scaler_merge_mode() const;
     void set_scaler_merge_mode(int mode);
+    uint64_t get_scaler_version() const;
+
+    // Nearest T at or above node. A SpellCaster is usually a plain Node under the character
+    // body, so executors resolve the caster's position (Node3D) or collision body
+    // (CollisionObject3D) through this.
+    template <typename T>
+    static T *find_self_or_ancestor(Node *node) {
+        for (Node *n = node; n; n = n->get_parent()) {
+            if (T *found = Object::cast_to<T>(n)) return found;
+        }
+        return nullptr;
+    }
 };
@@ -28,6 +28,9 @@ private:
     // per-component synergy modifiers: synergy_key -> Dictionary
     Dictionary synergy_modifiers;
 
+    // bumped by every setter so caches keyed on this component can detect edits
+    uint64_t version = 0;
+
 public:
     String get_executor_id() const;
     void set_executor_id(const String &p_id);
@@ -41,15 +44,23 @@ public:
     Dictionary get_params() const; // legacy alias to base_params
     void set_params(const Dictionary &p_params);
 
+    // The returned Dictionary is shared; after editing it in place (e.g.
+    // base_params["damage"] = 5) call mark_changed(), or cached resolutions keep the old values.
     Dictionary get_base_params() const;
     void set_base_params(const Dictionary &p);
 
     Dictionary get_aspects_contributions() const;
     void set_aspects_contributions(const Dictionary &d);
 
+    // Shared like base_params: in-place edits need a mark_changed() call.
     Dictionary get_aspect_modifiers() const;
     void set_aspect_modifiers(const Dictionary &d);
 
     Dictionary get_synergy_modifiers() const;
     void set_synergy_modifiers(const Dictionary &d);
+
+    // Edit counter. In-place edits of the returned Dictionaries do not bump it;
+    // call mark_changed() after such edits.
+    uint64_t get_version() const;
+    void mark_changed();
 };
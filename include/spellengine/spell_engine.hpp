@@ -3,10 +3,17 @@
 
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 #include "spellengine/aspect.hpp"
 #include "spellengine/spell.hpp"
+#include "spellengine/compiled_spell.hpp"
+#include "spellengine/param_block.hpp"
+#include <list>
+#include <unordered_map>
+#include <vector>
 
 class SpellCaster;
+class SpellTemplate;
 
 using namespace godot;
 
@@ -25,14 +32,88 @@ private:
     bool verbose_composition = false;
     // incrementing counter for generated cast ids
     uint64_t cast_counter = 0;
+    // bumped when merge mode defaults or mana multipliers change
+    uint64_t config_revision = 0;
+
+    // Memoized resolve_component_params results. Entries are keyed by a hash of the
+    // inputs and verified field-by-field on lookup; stored results are returned to scripts
+    // as deep copies because callers mutate the resolved params they receive. When the
+    // cache is full the least recently used entry is evicted.
+    struct ResolutionCacheEntry {
+        Ref<SpellComponent> component;
+        uint64_t component_version = 0;
+        uint64_t caster_id = 0;
+        uint64_t caster_scaler_version = 0;
+        uint64_t synergy_revision = 0;
+        uint64_t config_revision = 0;
+        Array casting_aspects;
+        Variant merge_modes;
+        Dictionary result;
+        // result["resolved_params"] pre-converted for native executors
+        ParamBlock params;
+        // position in resolution_lru
+        std::list<uint64_t>::iterator lru_pos;
+    };
+    std::unordered_map<uint64_t, ResolutionCacheEntry> resolution_cache;
+    // cache keys, most recently used first
+    std::list<uint64_t> resolution_lru;
+    bool resolution_cache_enabled = true;
+    int resolution_cache_capacity = 4096;
+    uint64_t resolution_cache_hits = 0;
+    uint64_t resolution_cache_misses = 0;
+
+    // Scratch state for get_adjusted_mana_costs_parallel; only valid during a call
+    struct CostEvalCast {
+        Dictionary ctx_params;
+        Array casting_aspects;
+        SpellCaster *caster = nullptr;
+    };
+    struct CostEvalItem {
+        Ref<SpellComponent> component;
+        int cast_index = 0;
+    };
+    std::vector<CostEvalCast> cost_eval_casts;
+    std::vector<CostEvalItem> cost_eval_items;
+    std::vector<Dictionary> cost_eval_results;
+    // below this many components the parallel path evaluates inline
+    static constexpr int PARALLEL_COST_MIN_ITEMS = 8;
 
 public:
     // Build a Spell from a list of aspects. Currently this simply aggregates components.
     Ref<Spell> build_spell_from_aspects(const TypedArray<Ref<Aspect>> &aspects);
 
-    // Execute a spell with a given context
+    // Execute a spell with a given context (compiles or reuses the spell's cached plan).
+    // Components after a time-sliced or async summon run once its instances have spawned
+    // (SummonSpawnQueue::call_when_spawned), within the same cast id.
+    // Damage is batched (DamageAccumulator): every target, native SpellTarget or script,
+    // receives the cast's hits in order after its last component ran, or when an enclosing
+    // begin/end_damage_batch() or execute_spells_batch() closes. A component therefore does
+    // not see health changes made by earlier components of the same cast.
     void execute_spell(Ref<Spell> spell, Ref<SpellContext> ctx);
 
+    // Compile a spell into a flat execution plan. The plan is cached on the Spell and
+    // reused until its components or the executor registry change.
+    Ref<CompiledSpell> compile_spell(Ref<Spell> spell);
+    // Compile a SpellTemplate's components into a standalone (uncached) plan.
+    Ref<CompiledSpell> compile_template(Ref<SpellTemplate> tmpl);
+    // Execute a precompiled plan with a given context
+    void execute_compiled(Ref<CompiledSpell> plan, Ref<SpellContext> ctx);
+
+    // Per-cast status codes returned by the batch API
+    enum CastStatus {
+        CAST_OK = 0,
+        CAST_INVALID_ARGS = 1,
+        CAST_INSUFFICIENT_MANA = 2,
+        CAST_EXECUTOR_FAILED = 3
+    };
+
+    // Execute many casts in one call. Each entry is a Dictionary {"spell", "context"}
+    // or a two-element Array [spell, context]. Casts run in order; each distinct spell is
+    // compiled once per batch. Returns one CastStatus per entry.
+    PackedInt32Array execute_spells_batch(const Array &casts);
+    // Typed variant: spells[i] is cast with contexts[i].
+    PackedInt32Array execute_spells_batch_typed(const TypedArray<Spell> &spells, const TypedArray<SpellContext> &contexts);
+
         // Merge mode constants
         enum MergeMode {
             MERGE_OVERWRITE = 0,
@@ -57,6 +138,11 @@ public:
     // Helper: compute adjusted mana costs for a whole spell given a context
     // Returns a Dictionary: {"costs_per_aspect": Dictionary, "total_mana": float, "per_component": Dictionary}
     Dictionary get_adjusted_mana_costs(Ref<Spell> spell, Ref<SpellContext> ctx);
+    // Read-only planner variant: evaluates many casts at once, fanning component resolution
+    // out over the WorkerThreadPool. Entries use the batch format ({"spell", "context"} or
+    // [spell, context]); returns one get_adjusted_mana_costs-shaped Dictionary per entry.
+    // Does not use or populate the resolution cache. Call from the main thread.
+    Array get_adjusted_mana_costs_parallel(const Array &casts);
 
     // Collect control components that require interactive resolution before execution.
     // Returns an ordered Array of Dictionaries with keys: index, executor_id, base_params, param_schema
@@ -74,12 +160,68 @@ public:
     // Validate a control result server-side. Returns true if valid.
     bool validate_control_result(const String &mode, const Dictionary &result) const;
 
+    // Per-cast span recording (resolve, mana, execute, synergy callables, extra executors).
+    // Spans carry the cast's "spell_cast_N" id; dump_trace writes Chrome trace-event JSON
+    // loadable in Perfetto or chrome://tracing and returns a godot Error code.
+    void set_trace_enabled(bool enabled);
+    bool get_trace_enabled() const;
+    void clear_trace();
+    int dump_trace(const String &path) const;
+
+    // Target method probes (apply_damage, apply_knockback_meta, ...) are cached per target and
+    // redone when its script is swapped; call after hot-reloading a target script that gained
+    // or lost those methods.
+    void clear_target_capabilities();
+    // True while a summoned node is parked inert, waiting for a force to activate it.
+    bool is_spell_inert(Object *node) const;
+
+    // Widen damage coalescing beyond a single cast (e.g. around a frame's worth of casts):
+    // hits on a target are delivered once, via apply_damage_batch when it exists, when the
+    // outermost batch ends. Calls must be balanced.
+    void begin_damage_batch();
+    void end_damage_batch();
+
+    // Process-wide pipeline counters and resolve/execute latency percentiles (also exposed
+    // as spellengine/* Performance monitors)
+    Dictionary get_stats() const;
+    void reset_stats();
+
     // Verbose composition logging control
     void set_verbose_composition(bool v);
     bool get_verbose_composition() const;
 
+    // Parameter resolution cache. Invalidation relies on the version counters of
+    // SpellComponent, SpellCaster (scalers) and SynergyRegistry; verbose composition
+    // always bypasses the cache so every stage is logged.
+    void set_resolution_cache_enabled(bool enabled);
+    bool get_resolution_cache_enabled() const;
+    void set_resolution_cache_capacity(int capacity);
+    int get_resolution_cache_capacity() const;
+    void clear_resolution_cache();
+    // Returns {"hits": int, "misses": int, "entries": int}
+    Dictionary get_resolution_cache_stats() const;
+
 private:
+    // Shared execution path for execute_compiled and the batch API; returns a CastStatus.
+    int _execute_plan(const Ref<CompiledSpell> &plan, const Ref<SpellContext> &ctx);
+    // Run plan steps from first_step on under an existing cast number; stops early (and resumes
+    // itself) when a step leaves summon groups queued in ctx.results.spawn_groups.
+    int _execute_steps(const Ref<CompiledSpell> &plan, const Ref<SpellContext> &ctx, size_t first_step, uint64_t cast_number);
+    // call_when_spawned callback for a plan parked behind queued summons
+    void _resume_plan(const Ref<CompiledSpell> &plan, const Ref<SpellContext> &ctx, int64_t next_step, int64_t cast_number);
+    // WorkerThreadPool group task body for get_adjusted_mana_costs_parallel
+    void _evaluate_cost_item(uint32_t p_index);
+    int _execute_batch_entry(const Ref<Spell> &spell, const Ref<SpellContext> &ctx, std::unordered_map<const Spell *, Ref<CompiledSpell>> &plans);
+    // Resolve for execution without copying: r_resolved shares the cached Dictionary and must
+    // not be modified. r_params receives the resolved params as a ParamBlock when non-null.
+    void _resolve_shared(const Ref<SpellComponent> &component, const Array &casting_aspects, SpellCaster *caster, const Dictionary &ctx_params, Dictionary &r_resolved, ParamBlock *r_params);
+    // Evict least recently used resolution cache entries until at most max_entries remain
+    void _trim_resolution_cache(int max_entries);
+    // Uncached implementation behind resolve_component_params
+    Dictionary _resolve_component_params_uncached(Ref<SpellComponent> component, const Array &casting_aspects, SpellCaster *caster, const Dictionary &ctx_params);
     // Internal forwarder used as the bound callable target. Receives the orchestrator's
     // out dictionary and two bound variants: orch (Object) and original callback (Callable).
     void _resolve_controls_forward(const Variant &out, const Variant &orch_v, const Variant &orig_cb_v);
+    // Run combined-key synergy callables and extra_executors for a component that just executed.
+    void _run_component_synergies(Ref<SpellContext> ctx, Ref<SpellComponent> comp, const Dictionary &resolved, const ParamBlock &params_with_cast, uint64_t cast_number, SpellCaster *sc);
 };
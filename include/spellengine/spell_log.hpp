@@ -0,0 +1,91 @@
+// SpellLog: per-subsystem log channels with compile-time level cutoff and an in-memory ring buffer
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <atomic>
+#include <cstdint>
+
+using namespace godot;
+
+// Highest level compiled into the binary. Debug/editor builds keep everything;
+// release builds keep warnings and errors only, so SPELL_DEBUG/SPELL_TRACE
+// statements (and the String formatting in their arguments) vanish entirely.
+#ifndef SPELLENGINE_LOG_MAX_LEVEL
+#ifdef DEBUG_ENABLED
+#define SPELLENGINE_LOG_MAX_LEVEL 4
+#else
+#define SPELLENGINE_LOG_MAX_LEVEL 1
+#endif
+#endif
+
+class SpellLog : public Object {
+    GDCLASS(SpellLog, Object)
+
+protected:
+    static void _bind_methods();
+
+public:
+    enum Channel {
+        CHANNEL_ENGINE,
+        CHANNEL_SYNERGY,
+        CHANNEL_EXECUTOR,
+        CHANNEL_SUMMON,
+        CHANNEL_FORCE,
+        CHANNEL_REGISTRY,
+        CHANNEL_CONTROL,
+        CHANNEL_MAX,
+    };
+
+    enum Level {
+        LEVEL_ERROR = 0,
+        LEVEL_WARN = 1,
+        LEVEL_INFO = 2,
+        LEVEL_DEBUG = 3,
+        LEVEL_TRACE = 4,
+    };
+
+    static constexpr int RING_CAPACITY = 512;
+
+private:
+    // Runtime threshold per channel; messages above it are dropped before formatting.
+    static std::atomic<uint8_t> channel_levels[CHANNEL_MAX];
+    static std::atomic<bool> echo;
+
+public:
+    static bool is_enabled(int channel, int level) {
+        if (channel < 0 || channel >= CHANNEL_MAX) return false;
+        return level <= (int)channel_levels[channel].load(std::memory_order_relaxed);
+    }
+    // Append to the ring buffer and, when echo is on, print to the output log.
+    static void write(int channel, int level, const String &message);
+
+    static void set_channel_level(int channel, int level);
+    static int get_channel_level(int channel);
+    static void set_all_channel_levels(int level);
+    static void set_echo(bool enabled);
+    static bool get_echo();
+    static int get_compiled_max_level();
+    // Oldest first: [{ "channel", "level", "time_usec", "message" }, ...]
+    static Array get_entries();
+    static void clear_entries();
+};
+
+VARIANT_ENUM_CAST(SpellLog::Channel);
+VARIANT_ENUM_CAST(SpellLog::Level);
+
+// m_message is only evaluated when the level is compiled in and enabled for the channel.
+#define SPELL_LOG(m_channel, m_level, m_message) \
+    do { \
+        if constexpr ((int)(m_level) <= SPELLENGINE_LOG_MAX_LEVEL) { \
+            if (SpellLog::is_enabled((m_channel), (m_level))) SpellLog::write((m_channel), (m_level), (m_message)); \
+        } \
+    } while (0)
+
+#define SPELL_ERROR(m_channel, m_message) SPELL_LOG(m_channel, SpellLog::LEVEL_ERROR, m_message)
+#define SPELL_WARN(m_channel, m_message) SPELL_LOG(m_channel, SpellLog::LEVEL_WARN, m_message)
+#define SPELL_INFO(m_channel, m_message) SPELL_LOG(m_channel, SpellLog::LEVEL_INFO, m_message)
+#define SPELL_DEBUG(m_channel, m_message) SPELL_LOG(m_channel, SpellLog::LEVEL_DEBUG, m_message)
+#define SPELL_TRACE(m_channel, m_message) SPELL_LOG(m_channel, SpellLog::LEVEL_TRACE, m_message)
@@ -0,0 +1,51 @@
+// SpellStats: process-wide spell pipeline counters, latency histograms and Performance monitors
+#pragma once
+
+#include <godot_cpp/variant/dictionary.hpp>
+#include <atomic>
+#include <cstdint>
+
+using namespace godot;
+
+// Fixed power-of-two bucket latency histogram. Bucket 0 holds 0 usec samples and bucket i
+// holds [2^(i-1), 2^i) usec; percentiles report the bucket's upper bound.
+class LatencyHistogram {
+public:
+    static constexpr int BUCKET_COUNT = 32;
+
+private:
+    std::atomic<uint64_t> buckets[BUCKET_COUNT] = {};
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> total_usec{ 0 };
+
+public:
+    void record(uint64_t usec);
+    double percentile(double q) const;
+    uint64_t get_count() const { return count.load(std::memory_order_relaxed); }
+    void reset();
+    // {"count", "mean_usec", "p50_usec", "p90_usec", "p99_usec"}
+    Dictionary to_dictionary() const;
+};
+
+class SpellStats {
+public:
+    static std::atomic<uint64_t> casts;
+    static std::atomic<uint64_t> components_executed;
+    static std::atomic<uint64_t> synergy_hits;
+    static std::atomic<int64_t> status_effects_live;
+    static std::atomic<uint64_t> summons_spawned;
+    static std::atomic<int64_t> projectiles_live;
+    static LatencyHistogram resolve_latency;
+    static LatencyHistogram execute_latency;
+
+    static void count(std::atomic<uint64_t> &counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+
+    // Casts per second averaged over the interval since the previous sample (main thread).
+    static double sample_casts_per_sec();
+    static Dictionary get_stats();
+    static void reset();
+
+    // Add/remove the spellengine/* custom monitors (module init / shutdown).
+    static void register_monitors();
+    static void unregister_monitors();
+};
@@ -0,0 +1,64 @@
+// SpellTarget: native damage/knockback receiver with health and per-aspect resistances
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+// Executors detect a SpellTarget with cast_to (either the target itself, or the node it is
+// attached under as a component) and call it directly instead of going through Variant
+// call() into script. It exposes the same apply_* methods as script targets, so code that
+// calls those by name keeps working, and reports results through signals.
+class SpellTarget : public Node {
+    GDCLASS(SpellTarget, Node)
+
+protected:
+    static void _bind_methods();
+    void _notification(int p_what);
+
+private:
+    double max_health = 100.0;
+    double health = 100.0;
+    // Damage taken is multiplied by (1 - resistance), indexed by interned aspect id
+    std::vector<double> resistances;
+    // Authored key per aspect id, exported by get_resistances (ids themselves are case-folded)
+    std::vector<String> resistance_keys;
+    // Knockback impulses accumulated since the last consume_knockback()
+    Vector3 pending_knockback;
+    bool dead = false;
+    // Parent instance id -> the SpellTarget attached to it as a component (first one wins)
+    static std::unordered_map<uint64_t, SpellTarget *> attached;
+    uint64_t attached_parent_id = 0;
+
+public:
+    // The SpellTarget for obj: obj itself, or one attached to obj as a child component.
+    static SpellTarget *from_object(Object *obj);
+
+    void set_max_health(double value);
+    double get_max_health() const;
+    void set_health(double value);
+    double get_health() const;
+    bool is_dead() const;
+    void set_resistances(const Dictionary &by_aspect);
+    Dictionary get_resistances() const;
+    void set_resistance(const String &aspect, double value);
+    double get_resistance(const String &aspect) const;
+
+    // Returns the damage actually applied after resistance
+    double apply_damage(double amount, const String &aspect, const Dictionary &meta);
+    // Script-compatible batched delivery: Array of { "amount", "aspect", "meta" }
+    void apply_damage_batch(const Array &packets);
+    void apply_heal(double amount);
+    // Accumulates force along caster -> owner (straight up when positions are unavailable)
+    void apply_knockback_meta(double force, double speed, double area, Object *caster, const Dictionary &meta);
+    void apply_knockback(double force, double speed, double area, Object *caster);
+    Vector3 get_pending_knockback() const;
+    // Returns and clears the accumulated knockback impulse
+    Vector3 consume_knockback();
+};
@@ -0,0 +1,59 @@
+// SpellTrace: lock-free span recorder for per-cast timelines, exported as Chrome trace-event JSON
+#pragma once
+
+#include <godot_cpp/variant/string.hpp>
+#include <atomic>
+#include <cstdint>
+
+using namespace godot;
+
+// Spans are written into a fixed ring of slots claimed with an atomic counter, so
+// recording from planner worker threads never blocks. When the ring wraps, the
+// oldest spans are overwritten. Recording is off until SpellEngine::set_trace_enabled(true).
+class SpellTrace {
+public:
+    static constexpr int RING_CAPACITY = 16384;
+    static constexpr int DETAIL_LENGTH = 48;
+
+    static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+    static void set_enabled(bool p_enabled) { enabled.store(p_enabled, std::memory_order_relaxed); }
+    static uint64_t now_usec();
+
+    // `name` must be a string literal (stored by pointer). `detail` is copied and truncated.
+    static void record(const char *name, uint64_t cast_number, const String &detail, uint64_t start_usec, uint64_t end_usec);
+    static void clear();
+    // Write all recorded spans as {"traceEvents": [...]} to `path`. Returns a godot::Error.
+    static int dump(const String &path);
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+// RAII span. Costs one relaxed load when tracing is disabled.
+class SpellTraceScope {
+    const char *name;
+    uint64_t cast_number;
+    String detail;
+    uint64_t start_usec = 0;
+    bool active;
+
+public:
+    SpellTraceScope(const char *p_name, uint64_t p_cast_number, const String &p_detail = String()) :
+            name(p_name), cast_number(p_cast_number), active(SpellTrace::is_enabled()) {
+        if (active) {
+            detail = p_detail;
+            start_usec = SpellTrace::now_usec();
+        }
+    }
+    ~SpellTraceScope() {
+        if (active) SpellTrace::record(name, cast_number, detail, start_usec, SpellTrace::now_usec());
+    }
+    SpellTraceScope(const SpellTraceScope &) = delete;
+    SpellTraceScope &operator=(const SpellTraceScope &) = delete;
+};
+
+#define SPELL_TRACE_CONCAT_INNER(a, b) a##b
+#define SPELL_TRACE_CONCAT(a, b) SPELL_TRACE_CONCAT_INNER(a, b)
+// Open a span covering the rest of the enclosing block.
+#define SPELL_TRACE_SPAN(m_name, m_cast_number, m_detail) \
+    SpellTraceScope SPELL_TRACE_CONCAT(_spell_trace_scope_, __LINE__)(m_name, m_cast_number, m_detail)
@@ -1,4 +1,4 @@
-// Public header for StatusEffect node used by DOT and timed effects
+// Public header for StatusEffect node: self-ticking timed effect, or a visual proxy for StatusEffectServer
 #pragma once
 
 #include <godot_cpp/classes/node.hpp>
@@ -18,9 +18,20 @@ private:
     double remaining_time = 0.0;
     String aspect = "";
     Dictionary metadata;
+    // Timer-driven effects count towards SpellStats::status_effects_live; proxies do not
+    bool counted = false;
 
 public:
+    ~StatusEffect();
+
+    // Start a self-ticking effect driven by a child Timer
     void configure(double amount, double interval, double duration, const String &p_aspect);
+    // Record the effect's parameters without ticking; StatusEffectServer owns its lifetime
+    void configure_proxy(double amount, double interval, double duration, const String &p_aspect);
+    double get_amount_per_tick() const { return amount_per_tick; }
+    double get_tick_interval() const { return tick_interval; }
+    String get_aspect() const { return aspect; }
+    Dictionary get_metadata() const { return metadata; }
     void set_metadata(const Dictionary &m);
     void _on_tick();
 };
@@ -0,0 +1,128 @@
+// StatusEffectServer: ticks all timed status effects (DoTs) from packed per-effect arrays
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+// One node under the SceneTree root owns every active effect. Effects are stored as
+// parallel arrays and advanced in a single _physics_process pass; ticks are collected
+// during the pass and delivered to targets afterwards, one DamageAccumulator batch per
+// pass, so target callbacks can add or remove effects safely. The node-based StatusEffect is only created as an optional
+// visual proxy (see set_visual_proxies_enabled).
+class StatusEffectServer : public Node {
+    GDCLASS(StatusEffectServer, Node)
+
+protected:
+    static void _bind_methods();
+
+public:
+    // How a new application merges with effects sharing its (target, aspect, source) key
+    enum StackPolicy {
+        // Each application ticks on its own; max_stacks evicts the entry closest to expiry
+        STACK_INDEPENDENT,
+        // One entry per key; re-application takes the new amount and interval and restarts the
+        // duration. The next tick keeps its timing unless the new interval is shorter.
+        STACK_REFRESH,
+        // As refresh, and each application adds a stack (up to max_stacks); a tick deals the
+        // latest amount_per_tick once per stack
+        STACK_ADDITIVE,
+        // One entry per key; the higher damage-per-second application wins, the weaker is dropped
+        STACK_STRONGEST,
+    };
+
+    // "independent", "refresh", "additive" or "strongest" (case-insensitive); unknown names map to independent
+    static StackPolicy stack_policy_from_string(const String &name);
+
+private:
+    static StatusEffectServer *singleton;
+
+    // Per-effect columns, index-aligned; removal swaps with the last entry
+    std::vector<int64_t> handles;
+    std::vector<uint64_t> target_ids;
+    std::vector<double> amount_per_tick;
+    std::vector<double> tick_interval;
+    std::vector<double> time_to_tick;
+    std::vector<double> remaining;
+    std::vector<String> aspects;
+    // Source executor/component id; part of the stacking key
+    std::vector<String> sources;
+    // Additive stack count; a tick deals amount_per_tick * stacks
+    std::vector<int32_t> stacks;
+    std::vector<Dictionary> metadata;
+    // Instance id of the visual StatusEffect proxy (0 if none)
+    std::vector<uint64_t> proxy_ids;
+
+    struct PendingHit {
+        uint64_t target_id;
+        double amount;
+        String aspect;
+        Dictionary meta;
+    };
+    std::vector<PendingHit> pending_hits;
+
+    // handle -> column index, and target instance id -> handles of its effects
+    std::unordered_map<int64_t, size_t> handle_index;
+    std::unordered_map<uint64_t, std::vector<int64_t>> target_effects;
+
+    int64_t next_handle = 1;
+    bool paused = false;
+    double time_scale = 1.0;
+    double hit_stop_remaining = 0.0;
+    bool visual_proxies_enabled = false;
+
+    int64_t push_effect(Node *target, double p_amount_per_tick, double p_tick_interval, double duration, const String &aspect, const String &source, const Dictionary &meta);
+    void remove_at(size_t index);
+    // Push a merged entry's current values to its visual proxy, if any
+    void sync_proxy(size_t index);
+    int find_index(int64_t handle) const;
+    void flush_hits();
+
+public:
+    StatusEffectServer();
+    ~StatusEffectServer();
+
+    // Existing server, or a new one queued for addition under the SceneTree root.
+    // Returns nullptr when there is no SceneTree (the caller should fall back to StatusEffect nodes).
+    static StatusEffectServer *get_singleton();
+
+    void _physics_process(double delta) override;
+
+    // Registers a ticking effect on target; the first tick lands one interval from now and
+    // the effect ticks while remaining duration > 0. Returns a handle for remove_effect(), or 0 if
+    // tick_interval or duration is not positive.
+    int64_t add_effect(Node *target, double p_amount_per_tick, double p_tick_interval, double duration, const String &aspect, const Dictionary &meta);
+    // add_effect with stacking: merges into the target's effects sharing (aspect, source) according
+    // to policy. max_stacks <= 0 means unlimited. Returns the handle of the new or merged effect,
+    // or 0 if the application was dropped (strongest-wins lost).
+    int64_t apply_effect(Node *target, double p_amount_per_tick, double p_tick_interval, double duration, const String &aspect, const String &source, int policy, int max_stacks, const Dictionary &meta);
+    bool remove_effect(int64_t handle);
+    int remove_effects_for_target(Node *target);
+    void clear();
+
+    int get_effect_count() const;
+    int get_effect_count_for_target(Node *target) const;
+    // Debug view: one { handle, amount_per_tick, tick_interval, remaining, aspect, source, stacks, metadata } per effect
+    Array get_effects_for_target(Node *target) const;
+
+    // Advance all effects by delta seconds (scaled, minus hit-stop) and deliver due ticks.
+    void advance(double delta);
+
+    void set_paused(bool p_paused);
+    bool is_paused() const;
+    void set_time_scale(double scale);
+    double get_time_scale() const;
+    // Freeze effect time for the given real-time seconds; overlapping calls keep the longest.
+    void apply_hit_stop(double seconds);
+    double get_hit_stop_remaining() const;
+
+    void set_visual_proxies_enabled(bool enabled);
+    bool get_visual_proxies_enabled() const;
+};
+
+VARIANT_ENUM_CAST(StatusEffectServer::StackPolicy);
@@ -2,9 +2,13 @@
 #pragma once
 
 #include "spellengine/executor_base.hpp"
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
 
 using namespace godot;
 
+class ScenePool;
+
 class SummonExecutor : public IExecutor {
     GDCLASS(SummonExecutor, IExecutor)
 
@@ -12,7 +16,42 @@ protected:
     static void _bind_methods();
 
 public:
+    // Typed params decoded from the resolved ParamBlock; initializers are the schema defaults
+    struct Params {
+        String scene_path;
+        Ref<PackedScene> scene;
+        Vector3 position;
+        bool position_from_caster = false;
+        Vector3 offset;
+        Vector3 rotation;
+        Vector3 scale = Vector3(1, 1, 1);
+        String pattern_type;
+        int64_t pattern_count = 1;
+        double pattern_spacing = 1.0;
+        Vector3 pattern_direction = Vector3(1, 0, 0);
+        Vector3 pattern_start_offset;
+        double pattern_radius = 1.0;
+        String pattern_plane = "xz";
+        double pattern_start_angle = 0.0;
+        int64_t pattern_rows = 1;
+        int64_t pattern_columns = 0;
+        double mana_cost = 0.0;
+        bool use_pool = false;
+        int64_t pool_warm_size = 0;
+        int64_t pool_cap = 32;
+        bool time_sliced = false;
+        bool async_instantiate = false;
+        bool multimesh = false;
+    };
+
+    // Instantiate (or acquire from pool) one instance, add it under parent at xform and make it inert.
+    // With batch_visuals its mesh is drawn through the MultiMeshBatcher.
+    static Node *spawn_instance(const Ref<PackedScene> &ps, ScenePool *pool, Node *parent, const Transform3D &xform, bool batch_visuals = false);
+    // Park a fresh instance until a force activates it (see InertRegistry).
+    static void make_inert(Node *inst);
+
     virtual void execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) override;
+    virtual void execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) override;
     virtual String get_executor_id() const override;
     virtual Dictionary get_param_schema() const override;
 };
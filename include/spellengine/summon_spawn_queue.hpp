@@ -0,0 +1,123 @@
+// SummonSpawnQueue: spreads large summon groups across frames under a per-frame budget
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include "spellengine/spell_context.hpp"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+class ScenePool;
+
+// Time-sliced SummonExecutor casts enqueue their spawn positions here instead of
+// instantiating everything inside execute(). Each _process the queue spawns from the oldest
+// group onwards until instances_per_frame instances or usec_per_frame microseconds are used
+// (at least one instance per frame), appending each batch to the context's targets and
+// results.spawned_instances. results.spawn_groups[group_id] holds the instances still to come;
+// group_spawned is emitted once a group is complete. SpellEngine parks the components that
+// follow a queued summon with call_when_spawned() and resumes them once every group of the
+// context is done, so they see the spawned instances.
+//
+// Async groups (enqueue_async) are instantiated on the WorkerThreadPool while still outside
+// the tree; once the group task has finished, _process commits them (add_child, then the
+// global transform, as SummonExecutor::spawn_instance does) under the same per-frame budget.
+class SummonSpawnQueue : public Node {
+    GDCLASS(SummonSpawnQueue, Node)
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct Group {
+        int64_t id = 0;
+        Ref<SpellContext> ctx;
+        Ref<PackedScene> scene;
+        ScenePool *pool = nullptr;
+        uint64_t parent_id = 0;
+        Transform3D xform;
+        std::vector<Vector3> positions;
+        size_t next = 0;
+        Array spawned;
+        // Draw spawned meshes through the MultiMeshBatcher
+        bool batch_visuals = false;
+        // Async groups only: WorkerThreadPool group task building the instances (-1 when done/none)
+        int64_t task_id = -1;
+        int64_t build_id = 0;
+        // Mana charged up front for the group's extra instances, refunded for those never spawned
+        uint64_t refund_caster_id = 0;
+        Dictionary refund_per_instance; // aspect -> mana per instance
+        size_t refundable = 0;
+    };
+    struct Waiter {
+        Ref<SpellContext> ctx;
+        Callable callback;
+    };
+    // Instances built off the main thread, one slot per position (written by exactly one task)
+    struct AsyncBuild {
+        Ref<PackedScene> scene;
+        std::vector<Node *> built;
+    };
+    std::deque<Group> groups;
+    std::vector<Waiter> waiters;
+    // build_id -> build state; the lock only guards the map, not the slots
+    std::unordered_map<int64_t, std::shared_ptr<AsyncBuild>> builds;
+    std::mutex builds_mutex;
+    int64_t next_group_id = 1;
+    int instances_per_frame = 8;
+    int64_t usec_per_frame = 2000;
+    static SummonSpawnQueue *singleton;
+
+    // Spawn up to max_count of the group's remaining instances; returns how many were attempted.
+    int spawn_from(Group &g, int max_count, uint64_t deadline_usec);
+    void finish(Group &g);
+    // Return the up-front mana for `cancelled` instances of g to its caster.
+    void refund(Group &g, size_t cancelled);
+    bool has_group_for(const Ref<SpellContext> &ctx) const;
+    // Async groups: false while the build task is still running (block waits for it instead).
+    bool is_ready(Group &g, bool block);
+    std::shared_ptr<AsyncBuild> get_build(int64_t build_id);
+    // Free built instances that will never be committed and forget the build.
+    void discard_build(Group &g);
+    void _build_instance(uint32_t p_index, int64_t p_build_id);
+
+public:
+    SummonSpawnQueue();
+    ~SummonSpawnQueue();
+
+    // Queue node under the SceneTree root, created on first use (null without a SceneTree)
+    static SummonSpawnQueue *get_singleton();
+
+    void _process(double delta) override;
+
+    // Queue one instance per position, each placed at xform with its origin replaced. Returns the group id.
+    int64_t enqueue(const Ref<SpellContext> &ctx, const Ref<PackedScene> &scene, ScenePool *pool, Node *parent, const Transform3D &xform, const std::vector<Vector3> &positions, bool batch_visuals = false);
+    // Like enqueue(), but instantiation runs on the WorkerThreadPool; the commit (add_child and
+    // placement against the parent as it is then) happens here.
+    int64_t enqueue_async(const Ref<SpellContext> &ctx, const Ref<PackedScene> &scene, Node *parent, const Transform3D &xform, const std::vector<Vector3> &positions, bool batch_visuals = false);
+    // Refund mana_per_instance (aspect -> amount) to caster for each of up to max_instances of the
+    // group's instances that end up cancelled instead of spawned.
+    void set_group_refund(int64_t group_id, Node *caster, const Dictionary &mana_per_instance, int max_instances);
+    // Call callback once no group enqueued for ctx is pending (right away if none is).
+    void call_when_spawned(const Ref<SpellContext> &ctx, const Callable &callback);
+    // Spend one frame's budget; called from _process, exposed for tests and manual stepping.
+    void advance();
+    // Spawn everything still queued right now.
+    void flush();
+    // Drop a group's remaining spawns (already spawned instances stay, up-front mana for the rest is
+    // refunded). Returns false if unknown.
+    bool cancel_group(int64_t group_id);
+    int get_pending_count() const;
+    int get_group_count() const;
+
+    void set_instances_per_frame(int count);
+    int get_instances_per_frame() const;
+    void set_usec_per_frame(int64_t usec);
+    int64_t get_usec_per_frame() const;
+};
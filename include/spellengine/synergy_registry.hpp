@@ -4,6 +4,7 @@
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/array.hpp>
+#include <unordered_map>
 
 using namespace godot;
 
@@ -15,8 +16,35 @@ protected:
 
 private:
     Dictionary synergies; // key -> Dictionary spec
+    uint64_t revision = 0; // bumped on register/unregister
     static SynergyRegistry *singleton;
 
+    // Aspect interning: lowercase aspect id -> bit index (0..63). Only aspects named by
+    // registered synergies get a bit, so unrelated aspect names never use up the 64 slots.
+    static constexpr int MAX_INDEXED_ASPECTS = 64;
+    struct StringHasher {
+        size_t operator()(const String &s) const { return (size_t)s.hash(); }
+    };
+    std::unordered_map<String, int, StringHasher> aspect_ids;
+    Array aspect_names; // bit index -> lowercase aspect id
+
+    // Synergies indexed by the bitmask of the aspect set they apply to.
+    struct MaskEntry {
+        String key;          // registry key the spec was registered under
+        String combined_key; // canonical sorted, lowercase "a+b" form
+        Dictionary spec;
+    };
+    std::unordered_map<uint64_t, MaskEntry> mask_index;
+    // Synergies whose aspect set could not get a bitmask (more than 64 distinct aspects),
+    // keyed by combined key. Filled by the same rules as mask_index so both resolve alike.
+    std::unordered_map<String, MaskEntry, StringHasher> overflow_index;
+    // Set when overflow_index is non-empty; lookups then fall back to it.
+    bool index_overflowed = false;
+
+    int intern_aspect(const String &aspect);
+    void index_synergy(const String &key, const Dictionary &spec);
+    void rebuild_index();
+
 public:
     static SynergyRegistry *get_singleton();
 
@@ -25,6 +53,24 @@ public:
     bool has_synergy(const String &key) const;
     Dictionary get_synergy(const String &key) const;
     Array get_synergy_keys() const;
+    uint64_t get_revision() const;
+    int get_synergy_count() const;
+
+    // Build the canonical combined key for an aspect set: lowercase, sorted, deduplicated,
+    // joined by '+'.
+    static String make_combined_key(const Array &aspects);
+    // Interned bit index for an aspect (case-insensitive), or -1 if unknown or not indexable.
+    int get_aspect_id(const String &aspect) const;
+    // Bitmask for an aspect set. Returns false if any aspect has never been interned,
+    // in which case no indexed synergy can match the set.
+    bool get_aspect_mask(const Array &aspects, uint64_t &r_mask) const;
+    // Find the synergy registered for an aspect set (order- and case-insensitive).
+    // On success returns the spec and, optionally, the canonical combined key.
+    bool find_synergy_for_aspects(const Array &aspects, Dictionary &r_spec, String *r_combined_key = nullptr) const;
+    // Single-aspect shortcut used for per-aspect default_scalers.
+    bool find_synergy_for_aspect(const String &aspect, Dictionary &r_spec) const;
+    // Script-facing variant: returns the canonical combined key, or "" if no synergy matches.
+    String get_synergy_key_for_aspects(const Array &aspects) const;
     // Helpers to register/load synergies from files.
     // Register spec under key by loading a JSON file or resource file that exposes a `spec` Dictionary property.
     bool register_from_path(const String &key, const String &resource_path);
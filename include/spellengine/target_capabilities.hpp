@@ -0,0 +1,45 @@
+// TargetCapabilities: per-target cache of the spell methods a target implements
+#pragma once
+
+#include <godot_cpp/core/object.hpp>
+#include <cstdint>
+#include <unordered_map>
+
+using namespace godot;
+
+// Executors probe targets for optional methods on every hit. The probes run once per target
+// instance and the result is kept as flags, so a repeat hit costs one hash lookup (no
+// get_script() or get_class() call). Each cached target's script_changed signal marks its
+// entry for a re-probe, so a node whose script is swapped resolves afresh; entries of freed
+// targets are swept as the cache grows. clear() drops everything (e.g. after a script
+// hot-reload). Main thread only.
+class TargetCapabilities {
+    struct Entry {
+        uint32_t flags = 0;
+        // false after the target's script changed; the script_changed connection stays
+        bool valid = true;
+    };
+    static std::unordered_map<uint64_t, Entry> by_instance;
+    // by_instance size that triggers the next sweep of freed targets
+    static size_t sweep_at;
+
+    static uint32_t probe(Object *obj);
+    static void sweep();
+    // script_changed handler
+    static void _forget(uint64_t instance_id);
+
+public:
+    enum Capability : uint32_t {
+        APPLY_DAMAGE = 1 << 0,
+        APPLY_DAMAGE_BATCH = 1 << 1,
+        APPLY_KNOCKBACK = 1 << 2,
+        APPLY_KNOCKBACK_META = 1 << 3,
+        RECORD_SPELL_EVENT = 1 << 4,
+        APPLY_HEAL = 1 << 5,
+    };
+
+    static uint32_t get(Object *obj);
+    static bool has(Object *obj, uint32_t capability) { return (get(obj) & capability) != 0; }
+    static void clear();
+    static int get_cache_size() { return (int)by_instance.size(); }
+};
@@ -1,46 +1,50 @@
 #include "spellengine/damage_executor.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/damage_accumulator.hpp"
+#include "spellengine/spell_target.hpp"
+#include "spellengine/target_capabilities.hpp"
 
 #include "spellengine/executor_registry.hpp"
+#include "spellengine/param_schema.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace godot;
 
+static constexpr auto DAMAGE_PARAMS = make_param_schema<DamageExecutor::Params>(
+        param_field("amount", &DamageExecutor::Params::amount, "Amount of damage to apply"),
+        param_field("aspect", &DamageExecutor::Params::aspect, "Aspect label (optional)"));
+
 void DamageExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {
+    execute_block(ctx, component, ParamBlock::from_dictionary(resolved_params));
+}
+
+void DamageExecutor::execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {
     if (!ctx.is_valid() || !component.is_valid()) return;
 
-    Dictionary params = resolved_params;
-    double amount = 0.0;
-    String aspect = "";
-    if (params.has("amount")) amount = (double)params["amount"];
-    if (params.has("aspect")) aspect = (String)params["aspect"];
+    static const int KEY_CAST_ID = ParamBlock::key("cast_id");
+    const Params p = DAMAGE_PARAMS.decode(params);
+    const double amount = p.amount;
+    const String &aspect = p.aspect;
+
+    // metadata template for this invocation; each target gets its own copy since targets may keep it
+    Dictionary meta;
+    meta["executor_id"] = String("damage_v1");
+    meta["phase"] = String("instant");
+    if (params.has(KEY_CAST_ID)) meta["cast_id"] = params.get(KEY_CAST_ID);
+    if (aspect != "") meta["aspect"] = aspect;
 
     Array targets = ctx->get_targets();
     for (int i = 0; i < targets.size(); ++i) {
         Variant v = targets[i];
         Object *obj = Object::cast_to<Object>(v);
-        Node *node = Object::cast_to<Node>(v);
-        if (node) {
-            if (node->has_method("apply_damage")) {
-                Dictionary meta;
-                meta["executor_id"] = String("damage_v1");
-                meta["phase"] = String("instant");
-                if (params.has("cast_id")) meta["cast_id"] = params["cast_id"];
-                if (aspect != "") meta["aspect"] = aspect;
-                node->call("apply_damage", Variant(amount), Variant(aspect), meta);
-            } else {
-                UtilityFunctions::print(String("DamageExecutor: target has no apply_damage: ") + node->get_name());
-            }
-        } else if (obj) {
-            if (obj->has_method("apply_damage")) {
-                Dictionary meta;
-                meta["executor_id"] = String("damage_v1");
-                meta["phase"] = String("instant");
-                if (params.has("cast_id")) meta["cast_id"] = params["cast_id"];
-                if (aspect != "") meta["aspect"] = aspect;
-                obj->call("apply_damage", Variant(amount), Variant(aspect), meta);
-            }
+        if (!obj) continue;
+        if (SpellTarget::from_object(obj) || TargetCapabilities::has(obj, TargetCapabilities::APPLY_DAMAGE | TargetCapabilities::APPLY_DAMAGE_BATCH)) {
+            // delivered when the engine's per-cast damage batch closes
+            DamageAccumulator::add_hit(obj, amount, aspect, meta.duplicate());
+        } else if (Node *node = Object::cast_to<Node>(obj)) {
+            SPELL_WARN(SpellLog::CHANNEL_EXECUTOR, String("DamageExecutor: target has no apply_damage: ") + node->get_name());
         }
     }
 }
@@ -54,20 +58,7 @@ String DamageExecutor::get_executor_id() const {
 }
 
 Dictionary DamageExecutor::get_param_schema() const {
-    Dictionary schema;
-    Dictionary e;
-    e["type"] = "float";
-    e["default"] = 0.0;
-    e["desc"] = "Amount of damage to apply";
-    schema["amount"] = e;
-
-    e = Dictionary();
-    e["type"] = "string";
-    e["default"] = String("");
-    e["desc"] = "Aspect label (optional)";
-    schema["aspect"] = e;
-
-    return schema;
+    return DAMAGE_PARAMS.to_dictionary();
 }
 
 // Register factory for automatic registration at module init
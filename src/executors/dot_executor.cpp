@@ -1,51 +1,67 @@
 #include "spellengine/dot_executor.hpp"
+#include "spellengine/spell_log.hpp"
 #include "spellengine/status_effect.hpp"
+#include "spellengine/status_effect_server.hpp"
 
 #include "spellengine/executor_registry.hpp"
+#include "spellengine/param_schema.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace godot;
 
+static constexpr auto DOT_PARAMS = make_param_schema<DotExecutor::Params>(
+        param_field("amount_per_tick", &DotExecutor::Params::amount_per_tick, "Amount per tick"),
+        param_field("tick_interval", &DotExecutor::Params::tick_interval, "Tick interval (seconds)"),
+        param_field("duration", &DotExecutor::Params::duration, "Duration (seconds)"),
+        param_field("aspect", &DotExecutor::Params::aspect, "Aspect label (optional)"),
+        param_field("stack_policy", &DotExecutor::Params::stack_policy, "Re-application on the same target/aspect/source: independent, refresh, additive or strongest"),
+        param_field("max_stacks", &DotExecutor::Params::max_stacks, "Cap on stacks (additive) or concurrent applications (independent); 0 = unlimited"));
+
 void DotExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {
+    execute_block(ctx, component, ParamBlock::from_dictionary(resolved_params));
+}
+
+void DotExecutor::execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {
     if (!ctx.is_valid() || !component.is_valid()) return;
 
-    UtilityFunctions::print(String("DotExecutor: executing for component: ") + component->get_executor_id());
-    UtilityFunctions::print(String("DotExecutor: received params:"));
-    UtilityFunctions::print(resolved_params);
+    SPELL_DEBUG(SpellLog::CHANNEL_EXECUTOR, String("DotExecutor: executing for component: ") + component->get_executor_id());
+    SPELL_TRACE(SpellLog::CHANNEL_EXECUTOR, String("DotExecutor: received params: ") + Variant(params.to_dictionary()).stringify());
+
+    static const int KEY_CAST_ID = ParamBlock::key("cast_id");
+    const Params p = DOT_PARAMS.decode(params);
+    const String &aspect = p.aspect;
 
-    Dictionary params = resolved_params;
-    double amount = 0.0;
-    double interval = 1.0;
-    double duration = 5.0;
-    String aspect = "";
+    // Metadata describing this executor invocation; each effect gets its own copy
+    Dictionary meta;
+    meta["executor_id"] = get_executor_id();
+    meta["triggering_component"] = component->get_executor_id();
+    meta["phase"] = String("dot");
+    // propagate cast_id if present in params so targets can group by cast
+    if (params.has(KEY_CAST_ID)) meta["cast_id"] = params.get(KEY_CAST_ID);
+    // also include the aspect so targets can label effects
+    if (aspect != "") meta["aspect"] = aspect;
 
-    if (params.has("amount_per_tick")) amount = (double)params["amount_per_tick"];
-    if (params.has("tick_interval")) interval = (double)params["tick_interval"];
-    if (params.has("duration")) duration = (double)params["duration"];
-    if (params.has("aspect")) aspect = (String)params["aspect"];
+    // Without a SceneTree there is no server; fall back to self-ticking StatusEffect nodes
+    StatusEffectServer *server = StatusEffectServer::get_singleton();
+    const StatusEffectServer::StackPolicy policy = StatusEffectServer::stack_policy_from_string(p.stack_policy);
+    const String source = component->get_executor_id();
 
     Array targets = ctx->get_targets();
     for (int i = 0; i < targets.size(); ++i) {
         Variant v = targets[i];
         Node *node = Object::cast_to<Node>(v);
-        if (node) {
-            StatusEffect *eff = memnew(StatusEffect);
-            // Add to the scene tree first so any timers started in configure() run correctly
-            node->add_child(eff);
-            // Attach metadata describing this executor invocation
-            Dictionary meta;
-            meta["executor_id"] = get_executor_id();
-            meta["triggering_component"] = component->get_executor_id();
-            meta["phase"] = String("dot");
-            // propagate cast_id if present in params so targets can group by cast
-            if (params.has("cast_id")) meta["cast_id"] = params["cast_id"];
-            // also include the aspect so targets can label effects
-            if (aspect != "") meta["aspect"] = aspect;
-            eff->set_metadata(meta);
-            eff->configure(amount, interval, duration, aspect);
+        if (!node) continue;
+        if (server) {
+            server->apply_effect(node, p.amount_per_tick, p.tick_interval, p.duration, aspect, source, policy, (int)p.max_stacks, meta.duplicate());
+            continue;
         }
+        StatusEffect *eff = memnew(StatusEffect);
+        // Add to the scene tree first so any timers started in configure() run correctly
+        node->add_child(eff);
+        eff->set_metadata(meta.duplicate());
+        eff->configure(p.amount_per_tick, p.tick_interval, p.duration, aspect);
     }
 }
 
@@ -58,32 +74,7 @@ String DotExecutor::get_executor_id() const {
 }
 
 Dictionary DotExecutor::get_param_schema() const {
-    Dictionary schema;
-    Dictionary e;
-    e["type"] = "float";
-    e["default"] = 0.0;
-    e["desc"] = "Amount per tick";
-    schema["amount_per_tick"] = e;
-
-    e = Dictionary();
-    e["type"] = "float";
-    e["default"] = 1.0;
-    e["desc"] = "Tick interval (seconds)";
-    schema["tick_interval"] = e;
-
-    e = Dictionary();
-    e["type"] = "float";
-    e["default"] = 5.0;
-    e["desc"] = "Duration (seconds)";
-    schema["duration"] = e;
-
-    e = Dictionary();
-    e["type"] = "string";
-    e["default"] = String("");
-    e["desc"] = "Aspect label (optional)";
-    schema["aspect"] = e;
-
-    return schema;
+    return DOT_PARAMS.to_dictionary();
 }
 
 // Register factory for automatic registration at module init
@@ -1,81 +1,79 @@
 #include "spellengine/knockback_executor.hpp"
+#include "spellengine/spell_log.hpp"
 
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 #include "spellengine/executor_registry.hpp"
+#include "spellengine/param_schema.hpp"
+#include "spellengine/spell_target.hpp"
+#include "spellengine/target_capabilities.hpp"
 
 using namespace godot;
 
+static constexpr auto KNOCKBACK_PARAMS = make_param_schema<KnockbackExecutor::Params>(
+        param_field("force", &KnockbackExecutor::Params::force, "Force applied"),
+        param_field("speed", &KnockbackExecutor::Params::speed, "Speed"),
+        param_field("area", &KnockbackExecutor::Params::area, "Area radius"));
+
 void KnockbackExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {
+    execute_block(ctx, component, ParamBlock::from_dictionary(resolved_params));
+}
+
+void KnockbackExecutor::execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {
     if (!ctx.is_valid() || !component.is_valid()) return;
 
-    Dictionary params = resolved_params;
-    double force = 400.0;
-    double speed = 500.0;
-    double area = 300.0;
-    if (params.has("force")) force = (double)params["force"];
-    if (params.has("speed")) speed = (double)params["speed"];
-    if (params.has("area")) area = (double)params["area"];
+    static const int KEY_CAST_ID = ParamBlock::key("cast_id");
+    const Params p = KNOCKBACK_PARAMS.decode(params);
+    const double force = p.force;
+    const double speed = p.speed;
+    const double area = p.area;
 
     Node *caster = ctx->get_caster();
 
+    // metadata for optional metadata-capable targets; each target gets its own copy
+    Dictionary meta;
+    meta["executor_id"] = get_executor_id();
+    meta["phase"] = String("knockback");
+    if (params.has(KEY_CAST_ID)) meta["cast_id"] = params.get(KEY_CAST_ID);
+
     Array targets = ctx->get_targets();
     for (int i = 0; i < targets.size(); ++i) {
         Variant v = targets[i];
         Node *node = Object::cast_to<Node>(v);
         if (!node) continue;
-
-        // prepare metadata for optional metadata-capable targets
-        Dictionary meta;
-        meta["executor_id"] = get_executor_id();
-        meta["phase"] = String("knockback");
-        if (params.has("cast_id")) meta["cast_id"] = params["cast_id"];
+        const Dictionary target_meta = meta.duplicate();
+        if (SpellTarget *st = SpellTarget::from_object(node)) {
+            st->apply_knockback_meta(force, speed, area, caster, target_meta);
+            continue;
+        }
+        const uint32_t caps = TargetCapabilities::get(node);
 
         // Prefer calling an extended API if target supports metadata-aware knockback
-        if (node->has_method("apply_knockback_meta")) {
-            node->call("apply_knockback_meta", Variant(force), Variant(speed), Variant(area), Variant(caster), meta);
+        if (caps & TargetCapabilities::APPLY_KNOCKBACK_META) {
+            node->call("apply_knockback_meta", Variant(force), Variant(speed), Variant(area), Variant(caster), target_meta);
             continue;
         }
 
-        if (node->has_method("apply_knockback")) {
+        if (caps & TargetCapabilities::APPLY_KNOCKBACK) {
             // fallback to the legacy 4-arg method
             node->call("apply_knockback", Variant(force), Variant(speed), Variant(area), Variant(caster));
             // also attempt to call a generic recorder if present so metadata isn't lost
-            if (node->has_method("record_spell_event")) {
-                node->call("record_spell_event", meta);
+            if (caps & TargetCapabilities::RECORD_SPELL_EVENT) {
+                node->call("record_spell_event", target_meta);
             }
             continue;
         }
 
-        UtilityFunctions::print(String("KnockbackExecutor: target lacks apply_knockback: ") + node->get_name());
+        SPELL_WARN(SpellLog::CHANNEL_EXECUTOR, String("KnockbackExecutor: target lacks apply_knockback: ") + node->get_name());
     }
 }
 
 void KnockbackExecutor::_bind_methods() {}
 
 Dictionary KnockbackExecutor::get_param_schema() const {
-    Dictionary schema;
-    Dictionary e;
-    e["type"] = "float";
-    e["default"] = 400.0;
-    e["desc"] = "Force applied";
-    schema["force"] = e;
-
-    e = Dictionary();
-    e["type"] = "float";
-    e["default"] = 500.0;
-    e["desc"] = "Speed";
-    schema["speed"] = e;
-
-    e = Dictionary();
-    e["type"] = "float";
-    e["default"] = 300.0;
-    e["desc"] = "Area radius";
-    schema["area"] = e;
-
-    return schema;
+    return KNOCKBACK_PARAMS.to_dictionary();
 }
 
 String KnockbackExecutor::get_executor_id() const {
@@ -0,0 +1,20 @@
+#include "spellengine/noop_executor.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+
+#include "spellengine/executor_registry.hpp"
+
+using namespace godot;
+
+void NoopExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {}
+
+void NoopExecutor::execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {}
+
+void NoopExecutor::_bind_methods() {}
+
+String NoopExecutor::get_executor_id() const {
+    return String("noop");
+}
+
+// Register factory for automatic registration at module init
+REGISTER_EXECUTOR_FACTORY(NoopExecutor)
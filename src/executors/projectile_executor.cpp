@@ -0,0 +1,113 @@
+#include "spellengine/projectile_executor.hpp"
+#include "spellengine/projectile_server.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/spell_caster.hpp"
+
+#include "spellengine/executor_registry.hpp"
+#include "spellengine/param_schema.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+
+using namespace godot;
+
+using P = ProjectileExecutor::Params;
+static constexpr auto PROJECTILE_PARAMS = make_param_schema<P>(
+        param_field("position", &P::position, "Launch position (x,y,z) when position_from_caster is false"),
+        param_field("position_from_caster", &P::position_from_caster, "Launch from the caster's global position plus 'offset'"),
+        param_field("offset", &P::offset, "Offset [x,y,z] added to the caster position"),
+        param_field("direction", &P::direction, "Launch direction [x,y,z]; a control's chosen_vector or chosen_position takes precedence"),
+        param_field("speed", &P::speed, "Launch speed (units per second)"),
+        param_field("count", &P::count, "Number of projectiles"),
+        param_field("spread", &P::spread, "Horizontal fan angle (radians) shared by the projectiles"),
+        param_field("gravity", &P::gravity, "Acceleration [x,y,z] applied every step"),
+        param_field("radius", &P::radius, "Collision sphere radius; 0 sweeps a ray"),
+        param_field("lifetime", &P::lifetime, "Seconds before an unhit projectile expires"),
+        param_field("collision_mask", &P::collision_mask, "Physics layers the projectile hits"),
+        param_field("impact_spell", &P::impact_spell, "Spell run on impact with the hit collider as target"),
+        param_field("impact_template", &P::impact_template, "SpellTemplate run on impact when no impact_spell is given (authorable in resources)"),
+        param_field("mesh", &P::mesh, "Mesh drawn for each projectile through the MultiMeshBatcher (none if empty)"));
+
+void ProjectileExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {
+    execute_block(ctx, component, ParamBlock::from_dictionary(resolved_params));
+}
+
+void ProjectileExecutor::execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {
+    if (!ctx.is_valid()) return;
+    ProjectileServer *server = ProjectileServer::get_singleton();
+    if (!server) {
+        SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("ProjectileExecutor: no SceneTree for the ProjectileServer; nothing launched"));
+        return;
+    }
+
+    const Params p = PROJECTILE_PARAMS.decode(params);
+    Node *caster = ctx->get_caster();
+
+    // a SpellCaster is a plain Node; launch from the body it belongs to
+    Vector3 origin = p.position;
+    Node3D *caster3d = SpellCaster::find_self_or_ancestor<Node3D>(caster);
+    if (p.position_from_caster && caster3d && caster3d->is_inside_tree()) origin = caster3d->get_global_transform().origin + p.offset;
+
+    // Same precedence as ForceExecutor: control vector, then control position, then the param
+    Dictionary results = ctx->get_results();
+    Vector3 dir = p.direction;
+    if (results.has("chosen_vector") && results["chosen_vector"].get_type() == Variant::VECTOR3) {
+        dir = results["chosen_vector"];
+    } else if (results.has("chosen_position") && results["chosen_position"].get_type() == Variant::VECTOR3) {
+        dir = (Vector3)results["chosen_position"] - origin;
+    }
+    if (dir.length() <= 0.0001) dir = Vector3(0, 0, -1);
+    dir = dir.normalized();
+
+    Ref<Spell> impact = p.impact_spell;
+    if (!impact.is_valid() && p.impact_template.is_valid()) impact = get_template_spell(p.impact_template);
+
+    const int count = p.count < 1 ? 1 : (int)p.count;
+    Array handles;
+    for (int i = 0; i < count; ++i) {
+        Vector3 d = dir;
+        if (count > 1 && p.spread != 0.0) {
+            const double angle = p.spread * ((double)i / (double)(count - 1) - 0.5);
+            d = dir.rotated(Vector3(0, 1, 0), (real_t)angle);
+        }
+        handles.append(server->spawn(origin, d * (real_t)p.speed, p.lifetime, p.radius, p.gravity, p.collision_mask, caster, impact, Dictionary(), p.mesh));
+    }
+
+    Array all = results.get("projectiles", Array());
+    all.append_array(handles);
+    results["projectiles"] = all;
+    ctx->set_results(results);
+}
+
+Ref<Spell> ProjectileExecutor::get_template_spell(const Ref<SpellTemplate> &tmpl) {
+    const uint64_t id = tmpl->get_instance_id();
+    auto it = template_spells.find(id);
+    if (it == template_spells.end()) {
+        for (auto e = template_spells.begin(); e != template_spells.end();) {
+            if (!ObjectDB::get_instance(e->first)) e = template_spells.erase(e);
+            else ++e;
+        }
+        Ref<Spell> spell;
+        spell.instantiate();
+        it = template_spells.emplace(id, spell).first;
+    }
+    // replacing the list drops the compiled plan, so only do it when the template changed
+    TypedArray<Ref<SpellComponent>> comps = tmpl->get_components();
+    if (it->second->get_components() != comps) it->second->set_components(comps);
+    return it->second;
+}
+
+void ProjectileExecutor::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("get_param_schema"), &ProjectileExecutor::get_param_schema);
+}
+
+String ProjectileExecutor::get_executor_id() const {
+    return String("projectile_v1");
+}
+
+Dictionary ProjectileExecutor::get_param_schema() const {
+    return PROJECTILE_PARAMS.to_dictionary();
+}
+
+// Register factory for automatic registration at module init
+REGISTER_EXECUTOR_FACTORY(ProjectileExecutor)
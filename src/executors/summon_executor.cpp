@@ -1,74 +1,112 @@
 #include "spellengine/summon_executor.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/spell_stats.hpp"
+#include "spellengine/scene_pool.hpp"
+#include "spellengine/scene_cache.hpp"
+#include "spellengine/summon_spawn_queue.hpp"
+#include "spellengine/multimesh_batcher.hpp"
+#include "spellengine/inert_registry.hpp"
 
 #include "spellengine/executor_registry.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
-#include <godot_cpp/classes/resource_loader.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/classes/node3d.hpp>
-#include <godot_cpp/classes/rigid_body3d.hpp>
 #include <godot_cpp/variant/transform3d.hpp>
 #include "spellengine/spell_caster.hpp"
+#include "spellengine/param_schema.hpp"
+#include <vector>
 
 using namespace godot;
 
-void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {
-    if (!ctx.is_valid()) return;
-
-    // Diagnostic: print resolved_params keys relevant to spawning
-    if (resolved_params.has("position_from_caster")) {
-        Variant v = resolved_params["position_from_caster"];
-        UtilityFunctions::print(String("SummonExecutor: resolved_params.position_from_caster present -> type=") + String::num(v.get_type()));
-        if (v.get_type() == Variant::BOOL) UtilityFunctions::print(String("SummonExecutor: position_from_caster=" ) + (Variant(v).operator String()));
-    } else {
-        UtilityFunctions::print(String("SummonExecutor: resolved_params.position_from_caster NOT present"));
+using S = SummonExecutor::Params;
+static constexpr auto SUMMON_PARAMS = make_param_schema<S>(
+        param_field("scene_path", &S::scene_path, "Path to a PackedScene resource to instantiate (res://...)"),
+        param_field("scene", &S::scene, "Optional PackedScene resource directly supplied"),
+        param_field("position", &S::position, "Position (x,y,z) to place the instance"),
+        param_field("position_from_caster", &S::position_from_caster, "If true, compute position from the caster's global transform and apply optional 'offset' array"),
+        param_field("offset", &S::offset, "Optional offset [x,y,z] to apply when using position_from_caster"),
+        param_field("rotation", &S::rotation, "Rotation Euler angles (radians) [x,y,z]"),
+        param_field("scale", &S::scale, "Scale (x,y,z)"),
+        param_field("pattern_type", &S::pattern_type, "Spawn pattern: linear, circular or rect (empty for a single spawn)"),
+        param_field("pattern_count", &S::pattern_count, "Number of spawns for linear/circular patterns"),
+        param_field("pattern_spacing", &S::pattern_spacing, "Distance between spawns for linear/rect patterns"),
+        param_field("pattern_direction", &S::pattern_direction, "Direction [x,y,z] of a linear pattern"),
+        param_field("pattern_start_offset", &S::pattern_start_offset, "Offset [x,y,z] applied to every pattern position"),
+        param_field("pattern_radius", &S::pattern_radius, "Radius of a circular pattern"),
+        param_field("pattern_plane", &S::pattern_plane, "Plane of a circular pattern: xz, xy or yz"),
+        param_field("pattern_start_angle", &S::pattern_start_angle, "Start angle (radians) of a circular pattern"),
+        param_field("pattern_rows", &S::pattern_rows, "Rows of a rect pattern"),
+        param_field("pattern_columns", &S::pattern_columns, "Columns of a rect pattern (0 uses pattern_count)"),
+        param_field("mana_cost", &S::mana_cost, "Mana per spawn; 0 uses the component cost"),
+        param_field("use_pool", &S::use_pool, "Reuse instances from the ScenePool; pooled instances should call ScenePool.release() instead of queue_free()"),
+        param_field("pool_warm_size", &S::pool_warm_size, "Instances pre-created the first time the scene's pool is used"),
+        param_field("pool_cap", &S::pool_cap, "Maximum released instances kept for reuse"),
+        param_field("time_sliced", &S::time_sliced, "Spread the spawns across frames through the SummonSpawnQueue budget; spawned_instances fills in as they appear and later components run once the group has spawned"),
+        param_field("async_instantiate", &S::async_instantiate, "Instantiate and set up instances on worker threads, adding them to the tree on a later frame (ignored with use_pool)"),
+        param_field("multimesh", &S::multimesh, "Draw the instances' mesh through one shared MultiMeshInstance3D per mesh instead of a MeshInstance3D each"));
+
+Node *SummonExecutor::spawn_instance(const Ref<PackedScene> &ps, ScenePool *pool, Node *parent, const Transform3D &xform, bool batch_visuals) {
+    // instantiate (or reuse) per-position
+    Node *inst = pool ? pool->acquire(ps) : ps->instantiate();
+    if (!inst) {
+        SPELL_ERROR(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: instantiate() returned null for PackedScene"));
+        return nullptr;
     }
-    if (resolved_params.has("offset")) {
-        Variant v = resolved_params["offset"];
-        UtilityFunctions::print(String("SummonExecutor: resolved_params.offset present -> type=") + String::num(v.get_type()));
-        // Print array or vector content
-        if (v.get_type() == Variant::VECTOR3) {
-            Vector3 vv = v;
-            UtilityFunctions::print(String("SummonExecutor: offset Vector3 = ") + Variant(vv).operator String());
-        } else if (v.get_type() == Variant::ARRAY) {
-            Array a = v;
-            UtilityFunctions::print(String("SummonExecutor: offset Array size=") + String::num(a.size()));
-        }
+    SpellStats::count(SpellStats::summons_spawned);
+    int64_t iid = inst->get_instance_id();
+    SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: instantiated PackedScene instance_id=") + Variant(iid).operator String());
+
+    if (parent) {
+        String parent_path = String("<no-path>");
+        if (parent->has_method("get_path")) parent_path = Variant(parent->get_path()).operator String();
+        SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: adding instance to parent: ") + parent_path);
+        parent->add_child(inst);
     } else {
-        UtilityFunctions::print(String("SummonExecutor: resolved_params.offset NOT present"));
+        SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: no valid parent found to add instance; skipping add_child"));
     }
 
-    // Prefer a direct PackedScene in 'scene', or a path in 'scene_path'
-    Ref<PackedScene> ps;
-    if (resolved_params.has("scene") && resolved_params["scene"].get_type() == Variant::OBJECT) {
-        Object *o = Object::cast_to<Object>(resolved_params["scene"]);
-        PackedScene *p = Object::cast_to<PackedScene>(o);
-        if (p) ps = Ref<PackedScene>(p);
+    Node3D *n3 = Object::cast_to<Node3D>(inst);
+    if (n3) {
+        // apply transform per-instance
+        SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: instance is Node3D, setting global transform. origin=") + Variant(xform.origin).operator String());
+        n3->set_global_transform(xform);
     }
 
-    if (!ps.is_valid() && resolved_params.has("scene_path")) {
-        Variant spv = resolved_params["scene_path"];
-        if (spv.get_type() == Variant::STRING) {
-            String path = spv;
-            Ref<Resource> r;
-            ResourceLoader *rl = ResourceLoader::get_singleton();
-            if (rl) r = rl->load(path);
-            if (r.is_valid()) {
-                PackedScene *p = Object::cast_to<PackedScene>(r.ptr());
-                if (p) ps = Ref<PackedScene>(p);
-            }
-        }
+    make_inert(inst);
+    if (batch_visuals) {
+        MultiMeshBatcher *batcher = MultiMeshBatcher::get_singleton();
+        if (batcher) batcher->track_node(inst);
     }
+    return inst;
+}
+
+void SummonExecutor::make_inert(Node *inst) {
+    InertRegistry::mark(inst);
+}
+
+void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> component, const Dictionary &resolved_params) {
+    execute_block(ctx, component, ParamBlock::from_dictionary(resolved_params));
+}
+
+void SummonExecutor::execute_block(Ref<SpellContext> ctx, Ref<SpellComponent> component, const ParamBlock &params) {
+    if (!ctx.is_valid()) return;
+
+    const Params p = SUMMON_PARAMS.decode(params);
+
+    // Diagnostic: print decoded params relevant to spawning
+    SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: position_from_caster=") + (p.position_from_caster ? String("true") : String("false")) + String(" offset=") + Variant(p.offset).operator String());
+
+    // Prefer a direct PackedScene in 'scene', or a path in 'scene_path'
+    Ref<PackedScene> ps = p.scene;
+    if (!ps.is_valid() && !p.scene_path.is_empty()) ps = SceneCache::get_singleton()->get_scene(p.scene_path);
 
     if (!ps.is_valid()) {
-        UtilityFunctions::print(String("SummonExecutor: missing or invalid PackedScene in params for component: ") + component->get_executor_id());
-        if (resolved_params.has("scene_path")) {
-            Variant spv = resolved_params["scene_path"];
-            if (spv.get_type() == Variant::STRING) {
-                UtilityFunctions::print(String("SummonExecutor: attempted scene_path = ") + String(spv));
-            }
+        SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: missing or invalid PackedScene in params for component: ") + component->get_executor_id());
+        if (!p.scene_path.is_empty()) {
+            SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: attempted scene_path = ") + p.scene_path);
         }
         return;
     }
@@ -79,168 +117,93 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
 
     // If caller requested position relative to caster, compute from caster + optional offset
     bool used_caster_position = false;
-    if (resolved_params.has("position_from_caster") && resolved_params["position_from_caster"].get_type() == Variant::BOOL && resolved_params["position_from_caster"]) {
+    if (p.position_from_caster) {
         Node *caster_node = ctx->get_caster();
         if (!caster_node) {
-            UtilityFunctions::print(String("SummonExecutor: caster_node is NULL when position_from_caster requested"));
+            SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: caster_node is NULL when position_from_caster requested"));
         } else {
-            // Print the caster's class for debugging
-            String ccls = caster_node->get_class();
-            UtilityFunctions::print(String("SummonExecutor: caster_node class = ") + ccls);
-            Node3D *nc = Object::cast_to<Node3D>(caster_node);
+            SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: caster_node class = ") + caster_node->get_class());
+            // The caster itself or its nearest Node3D ancestor (e.g. the CharacterBody3D holding a SpellCaster)
+            Node3D *nc = SpellCaster::find_self_or_ancestor<Node3D>(caster_node);
             if (nc) {
-                Vector3 caster_pos = nc->get_global_transform().origin;
-                UtilityFunctions::print(String("SummonExecutor: caster global origin = ") + Variant(caster_pos).operator String());
-                pos = caster_pos;
+                pos = nc->get_global_transform().origin;
+                SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: caster position from ") + nc->get_class() + String(" origin=") + Variant(pos).operator String());
                 used_caster_position = true;
             } else {
-                UtilityFunctions::print(String("SummonExecutor: caster_node is not a Node3D (cast failed). Searching ancestors for nearest Node3D."));
-                // Walk up the parent chain to find the nearest Node3D (e.g., CharacterBody3D)
-                Node *walker = caster_node->get_parent();
-                bool found_ancestor = false;
-                while (walker) {
-                    Node3D *anc = Object::cast_to<Node3D>(walker);
-                    if (anc) {
-                        Vector3 anc_pos = anc->get_global_transform().origin;
-                        UtilityFunctions::print(String("SummonExecutor: found Node3D ancestor class=") + walker->get_class() + String(" origin=") + Variant(anc_pos).operator String());
-                        pos = anc_pos;
-                        used_caster_position = true;
-                        found_ancestor = true;
-                        break;
-                    }
-                    walker = walker->get_parent();
-                }
-                // If no ancestor Node3D found, try to locate common spawn-point child nodes on the caster
-                if (!found_ancestor) {
-                    Array candidate_names;
-                    candidate_names.append(String("Muzzle"));
-                    candidate_names.append(String("MuzzlePoint"));
-                    candidate_names.append(String("SpawnPoint"));
-                    candidate_names.append(String("Hand"));
-                    candidate_names.append(String("WeaponPoint"));
-                    for (int ci = 0; ci < candidate_names.size() && !found_ancestor; ++ci) {
-                        String nm = candidate_names[ci];
-                        NodePath nm_path(nm);
-                        if (caster_node->has_node(nm_path)) {
-                            Node *cand = caster_node->get_node_or_null(nm_path);
-                            if (cand) {
-                                Node3D *cand3 = Object::cast_to<Node3D>(cand);
-                                if (cand3) {
-                                    Vector3 cand_pos = cand3->get_global_transform().origin;
-                                    UtilityFunctions::print(String("SummonExecutor: found spawn-point child '") + nm + String("' origin=") + Variant(cand_pos).operator String());
-                                    pos = cand_pos;
-                                    used_caster_position = true;
-                                    found_ancestor = true;
-                                    break;
-                                }
+                // If no Node3D was found, try to locate common spawn-point child nodes on the caster
+                Array candidate_names;
+                candidate_names.append(String("Muzzle"));
+                candidate_names.append(String("MuzzlePoint"));
+                candidate_names.append(String("SpawnPoint"));
+                candidate_names.append(String("Hand"));
+                candidate_names.append(String("WeaponPoint"));
+                for (int ci = 0; ci < candidate_names.size(); ++ci) {
+                    String nm = candidate_names[ci];
+                    NodePath nm_path(nm);
+                    if (caster_node->has_node(nm_path)) {
+                        Node *cand = caster_node->get_node_or_null(nm_path);
+                        if (cand) {
+                            Node3D *cand3 = Object::cast_to<Node3D>(cand);
+                            if (cand3) {
+                                Vector3 cand_pos = cand3->get_global_transform().origin;
+                                SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: found spawn-point child '") + nm + String("' origin=") + Variant(cand_pos).operator String());
+                                pos = cand_pos;
+                                used_caster_position = true;
+                                break;
                             }
                         }
                     }
                 }
+            }
 
             // If we determined a caster-based position, apply optional offset here so
             // offsets are handled uniformly regardless of whether the caster itself
             // was a Node3D or we located an ancestor/child spawn point.
-            if (used_caster_position && resolved_params.has("offset")) {
-                Variant offv = resolved_params["offset"];
-                if (offv.get_type() == Variant::ARRAY) {
-                    Array off = offv;
-                    if (off.size() >= 1) pos.x += (double)off[0];
-                    if (off.size() >= 2) pos.y += (double)off[1];
-                    if (off.size() >= 3) pos.z += (double)off[2];
-                } else if (offv.get_type() == Variant::VECTOR3) {
-                    Vector3 vv = offv;
-                    pos += vv;
-                }
-                UtilityFunctions::print(String("SummonExecutor: computed spawn pos after offset = ") + Variant(pos).operator String());
-            }
+            if (used_caster_position) {
+                pos += p.offset;
+                SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: computed spawn pos after offset = ") + Variant(pos).operator String());
             }
         }
     }
 
     // Fallback: explicit absolute position array overrides default
-    if (!used_caster_position && resolved_params.has("position") && resolved_params["position"].get_type() == Variant::ARRAY) {
-        Array parr = resolved_params["position"];
-        if (parr.size() >= 1) pos.x = (double)parr[0];
-        if (parr.size() >= 2) pos.y = (double)parr[1];
-        if (parr.size() >= 3) pos.z = (double)parr[2];
-    }
+    if (!used_caster_position) pos = p.position;
 
     // rotation: Euler angles in radians [x,y,z]
-    Basis b = Basis();
-    if (resolved_params.has("rotation") && resolved_params["rotation"].get_type() == Variant::ARRAY) {
-        Array rarr = resolved_params["rotation"];
-        double rx = 0.0, ry = 0.0, rz = 0.0;
-        if (rarr.size() >= 1) rx = (double)rarr[0];
-        if (rarr.size() >= 2) ry = (double)rarr[1];
-        if (rarr.size() >= 3) rz = (double)rarr[2];
-        // Compose rotations: yaw (Y), pitch (X), roll (Z) order: y * x * z
-        Quaternion qx = Quaternion(Vector3(1,0,0), rx);
-        Quaternion qy = Quaternion(Vector3(0,1,0), ry);
-        Quaternion qz = Quaternion(Vector3(0,0,1), rz);
-        Quaternion q = qy * qx * qz;
-        b = Basis(q);
-    }
+    // Compose rotations: yaw (Y), pitch (X), roll (Z) order: y * x * z
+    Quaternion qx = Quaternion(Vector3(1,0,0), p.rotation.x);
+    Quaternion qy = Quaternion(Vector3(0,1,0), p.rotation.y);
+    Quaternion qz = Quaternion(Vector3(0,0,1), p.rotation.z);
+    Basis b = Basis(qy * qx * qz);
 
     // scale
-    if (resolved_params.has("scale") && resolved_params["scale"].get_type() == Variant::ARRAY) {
-        Array sarr = resolved_params["scale"];
-        double sx = 1.0, sy = 1.0, sz = 1.0;
-        if (sarr.size() >= 1) sx = (double)sarr[0];
-        if (sarr.size() >= 2) sy = (double)sarr[1];
-        if (sarr.size() >= 3) sz = (double)sarr[2];
-        b.scale(Vector3((float)sx, (float)sy, (float)sz));
-    }
+    b.scale(p.scale);
 
     t.basis = b;
     t.origin = pos;
 
-    // Helper: parse a Vector3 from a Variant that may be an ARRAY or VECTOR3
-    auto parse_vec3 = [](const Variant &v, const Vector3 &fallback) -> Vector3 {
-        if (v.get_type() == Variant::VECTOR3) return Vector3(v);
-        if (v.get_type() == Variant::ARRAY) {
-            Array a = v;
-            double x = 0, y = 0, z = 0;
-            if (a.size() >= 1) x = (double)a[0];
-            if (a.size() >= 2) y = (double)a[1];
-            if (a.size() >= 3) z = (double)a[2];
-            return Vector3((float)x, (float)y, (float)z);
-        }
-        return fallback;
-    };
-
     // Generate spawn positions according to optional pattern parameters.
     Array spawn_positions;
     spawn_positions.append(pos);
-    if (resolved_params.has("pattern_type")) {
-        String ptype = resolved_params["pattern_type"];
-        int count = 1;
-        if (resolved_params.has("pattern_count")) {
-            Variant pc = resolved_params["pattern_count"];
-            if (pc.get_type() == Variant::Type::INT) count = (int)pc;
-            else if (pc.get_type() == Variant::Type::FLOAT) count = (int)((double)pc);
-        }
+    if (!p.pattern_type.is_empty()) {
+        const String &ptype = p.pattern_type;
+        int count = (int)p.pattern_count;
         if (count < 1) count = 1;
+        const double spacing = p.pattern_spacing;
+        const Vector3 &start_off = p.pattern_start_offset;
 
         if (ptype == String("linear")) {
-            double spacing = 1.0;
-            if (resolved_params.has("pattern_spacing")) spacing = (double)resolved_params["pattern_spacing"];
-            Vector3 dir = parse_vec3(resolved_params.has("pattern_direction") ? resolved_params["pattern_direction"] : Variant(), Vector3(1,0,0));
+            Vector3 dir = p.pattern_direction;
             if (dir.length() == 0) dir = Vector3(1,0,0);
             dir = dir.normalized();
-            Vector3 start_off = parse_vec3(resolved_params.has("pattern_start_offset") ? resolved_params["pattern_start_offset"] : Variant(), Vector3(0,0,0));
             spawn_positions.clear();
             for (int i = 0; i < count; ++i) {
-                Vector3 p = pos + start_off + dir * (float)(i * spacing);
-                spawn_positions.append(p);
+                spawn_positions.append(pos + start_off + dir * (float)(i * spacing));
             }
         } else if (ptype == String("circular")) {
-            double radius = 1.0;
-            if (resolved_params.has("pattern_radius")) radius = (double)resolved_params["pattern_radius"];
-            String plane = String("xz");
-            if (resolved_params.has("pattern_plane") && resolved_params["pattern_plane"].get_type() == Variant::STRING) plane = resolved_params["pattern_plane"];
-            double start_angle = 0.0;
-            if (resolved_params.has("pattern_start_angle")) start_angle = (double)resolved_params["pattern_start_angle"];
+            const double radius = p.pattern_radius;
+            const String &plane = p.pattern_plane;
+            const double start_angle = p.pattern_start_angle;
             spawn_positions.clear();
             for (int i = 0; i < count; ++i) {
                 double a = start_angle + (2.0 * Math_PI * (double)i) / (double)count;
@@ -248,25 +211,11 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
                 if (plane == String("xy")) off = Vector3((float)(radius * cos(a)), (float)(radius * sin(a)), 0.0f);
                 else if (plane == String("yz")) off = Vector3(0.0f, (float)(radius * cos(a)), (float)(radius * sin(a)));
                 else /* xz */ off = Vector3((float)(radius * cos(a)), 0.0f, (float)(radius * sin(a)));
-                Vector3 start_off = parse_vec3(resolved_params.has("pattern_start_offset") ? resolved_params["pattern_start_offset"] : Variant(), Vector3(0,0,0));
                 spawn_positions.append(pos + start_off + off);
             }
         } else if (ptype == String("rect" ) || ptype == String("rectangular")) {
-            int rows = 1;
-            int cols = count;
-            if (resolved_params.has("pattern_rows")) {
-                Variant pr = resolved_params["pattern_rows"];
-                if (pr.get_type() == Variant::Type::INT) rows = (int)pr;
-                else if (pr.get_type() == Variant::Type::FLOAT) rows = (int)((double)pr);
-            }
-            if (resolved_params.has("pattern_columns")) {
-                Variant pc2 = resolved_params["pattern_columns"];
-                if (pc2.get_type() == Variant::Type::INT) cols = (int)pc2;
-                else if (pc2.get_type() == Variant::Type::FLOAT) cols = (int)((double)pc2);
-            }
-            double spacing = 1.0;
-            if (resolved_params.has("pattern_spacing")) spacing = (double)resolved_params["pattern_spacing"];
-            Vector3 start_off = parse_vec3(resolved_params.has("pattern_start_offset") ? resolved_params["pattern_start_offset"] : Variant(), Vector3(0,0,0));
+            int rows = (int)p.pattern_rows;
+            int cols = p.pattern_columns > 0 ? (int)p.pattern_columns : count;
             spawn_positions.clear();
             for (int r = 0; r < rows; ++r) {
                 for (int c = 0; c < cols; ++c) {
@@ -283,12 +232,11 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
     // Charge additional mana for extra spawns beyond the first. The engine
     // already charged the component's mana_cost once during composition, so
     // we only need to deduct the extra (spawn_count - 1) * mana_cost here.
-    double unit_mana = 0.0;
-    if (resolved_params.has("mana_cost")) {
-        Variant mc = resolved_params["mana_cost"];
-        if (mc.get_type() == Variant::INT || mc.get_type() == Variant::FLOAT) unit_mana = (double)mc;
-    }
+    double unit_mana = p.mana_cost;
     if (unit_mana <= 0.0) unit_mana = component->get_cost();
+    // what one extra instance cost per aspect, so a queued group can refund cancelled spawns
+    SpellCaster *charged_caster = nullptr;
+    Dictionary extra_mana_per_instance;
 
     if (spawn_count > 1 && unit_mana > 0.0 && ctx.is_valid()) {
         double extra_total = unit_mana * (double)(spawn_count - 1);
@@ -302,7 +250,7 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
         if (aspects_list.size() == 0 && sc) aspects_list = sc->get_assigned_aspects();
 
         if (aspects_list.size() == 0) {
-            UtilityFunctions::print(String("SummonExecutor: no aspects available to charge mana for multi-spawn; aborting spawn"));
+            SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: no aspects available to charge mana for multi-spawn; aborting spawn"));
             // Signal abort in context results so callers can handle gracefully
             if (ctx.is_valid()) {
                 Dictionary r = ctx->get_results();
@@ -328,7 +276,7 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
         }
 
         if (!ok) {
-            UtilityFunctions::print(String("SummonExecutor: caster lacks mana for additional spawns; aborting spawn"));
+            SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: caster lacks mana for additional spawns; aborting spawn"));
             // Signal abort reason into context results to avoid leaving callers blind
             if (ctx.is_valid()) {
                 Dictionary r = ctx->get_results();
@@ -342,10 +290,13 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
         }
 
         // Deduct extra mana now
+        const double per_instance = unit_mana / (double)aspects_list.size();
         for (int ai = 0; ai < aspects_list.size(); ++ai) {
             String a = aspects_list[ai];
             sc->deduct_mana(a, per_aspect);
+            extra_mana_per_instance[a] = (double)extra_mana_per_instance.get(a, 0.0) + per_instance;
         }
+        charged_caster = sc;
     }
 
     // Determine parent once
@@ -357,6 +308,26 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
         if (!parent) parent = caster->get_parent();
     }
 
+    ScenePool *pool = nullptr;
+    if (p.use_pool) {
+        pool = ScenePool::get_singleton();
+        if (!pool->has_pool(ps)) pool->configure(ps, (int)p.pool_warm_size, (int)p.pool_cap);
+    }
+
+    // Time-sliced / async: hand the positions to the spawn queue (synchronous when there is no SceneTree)
+    // Async: instances are built on worker threads and committed by the queue (pooled instances are already built)
+    const bool async = p.async_instantiate && !pool;
+    SummonSpawnQueue *queue = (p.time_sliced || async) ? SummonSpawnQueue::get_singleton() : nullptr;
+    if (queue) {
+        std::vector<Vector3> positions;
+        positions.reserve(spawn_positions.size());
+        for (int si = 0; si < spawn_positions.size(); ++si) positions.push_back(spawn_positions[si]);
+        int64_t group = async ? queue->enqueue_async(ctx, ps, parent, t, positions, p.multimesh) : queue->enqueue(ctx, ps, pool, parent, t, positions, p.multimesh);
+        if (charged_caster) queue->set_group_refund(group, charged_caster, extra_mana_per_instance, spawn_count - 1);
+        SPELL_DEBUG(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: queued spawn group ") + String::num_int64(group) + String(" with ") + String::num_int64((int64_t)positions.size()) + String(" instances"));
+        return;
+    }
+
     Array cur_targets = ctx->get_targets();
     Dictionary cur_results = ctx->get_results();
     Array spawned_arr;
@@ -365,51 +336,14 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
     }
 
     for (int si = 0; si < spawn_positions.size(); ++si) {
-        Vector3 spos = spawn_positions[si];
-        // instantiate per-position
-        Node *inst = ps->instantiate();
-        if (!inst) {
-            UtilityFunctions::print(String("SummonExecutor: instantiate() returned null for PackedScene"));
-            continue;
-        }
-        int64_t iid = inst->get_instance_id();
-        UtilityFunctions::print(String("SummonExecutor: instantiated PackedScene instance_id=") + Variant(iid).operator String());
-
-        if (parent) {
-            String parent_path = String("<no-path>");
-            if (parent->has_method("get_path")) parent_path = Variant(parent->get_path()).operator String();
-            UtilityFunctions::print(String("SummonExecutor: adding instance to parent: ") + parent_path);
-            parent->add_child(inst);
-        } else {
-            UtilityFunctions::print(String("SummonExecutor: no valid parent found to add instance; skipping add_child"));
-        }
-
-        Node3D *n3 = Object::cast_to<Node3D>(inst);
-        if (n3) {
-            // apply transform per-instance
-            Transform3D it = t;
-            it.origin = spos;
-            UtilityFunctions::print(String("SummonExecutor: instance is Node3D, setting global transform. origin=") + Variant(spos).operator String());
-            n3->set_global_transform(it);
-        }
+        Transform3D it = t;
+        it.origin = spawn_positions[si];
+        Node *inst = spawn_instance(ps, pool, parent, it, p.multimesh);
+        if (!inst) continue;
 
         // Add to context lists
         cur_targets.append(inst);
         spawned_arr.append(inst);
-
-        // inert handling per-instance
-        inst->set_meta(String("spell_inert"), Variant(true));
-        RigidBody3D *rb = Object::cast_to<RigidBody3D>(inst);
-        if (rb) {
-            int prev_mode = 0;
-            Variant prev_mode_v = rb->get("mode");
-            if (prev_mode_v.get_type() == Variant::Type::INT) prev_mode = (int)prev_mode_v;
-            inst->set_meta(String("spell_prev_mode"), Variant(prev_mode));
-            rb->set("mode", Variant(1));
-            rb->set("freeze", Variant(true));
-        } else {
-            inst->set_physics_process(false);
-        }
     }
 
     // Write back targets/results
@@ -417,7 +351,7 @@ void SummonExecutor::execute(Ref<SpellContext> ctx, Ref<SpellComponent> componen
     cur_results["spawned_instances"] = spawned_arr;
     if (spawned_arr.size() > 0) cur_results["last_spawned"] = spawned_arr[spawned_arr.size() - 1];
     ctx->set_results(cur_results);
-    UtilityFunctions::print(String("SummonExecutor: appended spawned instances to ctx.targets and ctx.results; targets_size=") + String::num(cur_targets.size()));
+    SPELL_DEBUG(SpellLog::CHANNEL_SUMMON, String("SummonExecutor: appended spawned instances to ctx.targets and ctx.results; targets_size=") + String::num(cur_targets.size()));
 }
 
 void SummonExecutor::_bind_methods() {
@@ -429,56 +363,7 @@ String SummonExecutor::get_executor_id() const {
 }
 
 Dictionary SummonExecutor::get_param_schema() const {
-    Dictionary schema;
-    Dictionary e;
-
-    e = Dictionary();
-    e["type"] = "string";
-    e["default"] = String("");
-    e["desc"] = String("Path to a PackedScene resource to instantiate (res://...)");
-    schema["scene_path"] = e;
-
-    e = Dictionary();
-    e["type"] = "object";
-    e["default"] = Variant();
-    e["desc"] = String("Optional PackedScene resource directly supplied");
-    schema["scene"] = e;
-
-    e = Dictionary();
-    e["type"] = "array";
-    Array defpos; defpos.append(0.0); defpos.append(0.0); defpos.append(0.0);
-    e["default"] = defpos;
-    e["desc"] = String("Position (x,y,z) to place the instance");
-    schema["position"] = e;
-
-    e = Dictionary();
-    e["type"] = "bool";
-    e["default"] = false;
-    e["desc"] = String("If true, compute position from the caster's global transform and apply optional 'offset' array");
-    schema["position_from_caster"] = e;
-
-    e = Dictionary();
-    e["type"] = "array";
-    Array defoff; defoff.append(0.0); defoff.append(2.0); defoff.append(0.0);
-    e["default"] = defoff;
-    e["desc"] = String("Optional offset [x,y,z] to apply when using position_from_caster");
-    schema["offset"] = e;
-
-    e = Dictionary();
-    e["type"] = "array";
-    Array defrot; defrot.append(0.0); defrot.append(0.0); defrot.append(0.0);
-    e["default"] = defrot;
-    e["desc"] = String("Rotation Euler angles (radians) [x,y,z]");
-    schema["rotation"] = e;
-
-    e = Dictionary();
-    e["type"] = "array";
-    Array defscale; defscale.append(1.0); defscale.append(1.0); defscale.append(1.0);
-    e["default"] = defscale;
-    e["desc"] = String("Scale (x,y,z)");
-    schema["scale"] = e;
-
-    return schema;
+    return SUMMON_PARAMS.to_dictionary();
 }
 
 // Register factory for automatic registration at module init
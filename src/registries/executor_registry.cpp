@@ -1,4 +1,5 @@
 #include "spellengine/executor_registry.hpp"
+#include "spellengine/spell_log.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -17,12 +18,14 @@ ExecutorRegistry *ExecutorRegistry::get_singleton() {
 void ExecutorRegistry::register_executor(const String &id, Ref<IExecutor> executor) {
     if (!has_executor(id) && executor.is_valid()) {
         executors[id] = executor;
+        revision += 1;
     }
 }
 
 void ExecutorRegistry::unregister_executor(const String &id) {
     if (has_executor(id)) {
         executors.erase(id);
+        revision += 1;
     }
 }
 
@@ -40,6 +43,10 @@ Ref<IExecutor> ExecutorRegistry::get_executor(const String &id) const {
     return executors[id];
 }
 
+uint64_t ExecutorRegistry::get_revision() const {
+    return revision;
+}
+
 // Implementation of factory registration. We keep factories in a function-static
 // vector to avoid static-initialization-order issues.
 static std::vector<std::function<Ref<IExecutor>()>> &get_executor_factories() {
@@ -63,11 +70,12 @@ void ExecutorRegistry::register_all_factories() {
         if (id.is_empty()) continue;
         reg->register_executor(id, inst);
         // Diagnostic trace for factory registration
-        UtilityFunctions::print(String("[spellengine] ExecutorRegistry registered executor_factory -> ") + id);
+        SPELL_INFO(SpellLog::CHANNEL_REGISTRY, String("[spellengine] ExecutorRegistry registered executor_factory -> ") + id);
     }
 }
 
 void ExecutorRegistry::_bind_methods() {
+    ClassDB::bind_static_method("ExecutorRegistry", D_METHOD("get_singleton"), &ExecutorRegistry::get_singleton);
     ClassDB::bind_method(D_METHOD("register_executor", "id", "executor"), &ExecutorRegistry::register_executor);
     ClassDB::bind_method(D_METHOD("unregister_executor", "id"), &ExecutorRegistry::unregister_executor);
     ClassDB::bind_method(D_METHOD("get_executor_ids"), &ExecutorRegistry::get_executor_ids);
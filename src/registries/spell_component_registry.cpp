@@ -1,4 +1,5 @@
 #include "spellengine/spell_component_registry.hpp"
+#include "spellengine/scene_cache.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
@@ -15,7 +16,10 @@ SpellComponentRegistry *SpellComponentRegistry::get_singleton() {
 
 void SpellComponentRegistry::register_component(const String &id, Ref<SpellComponent> comp) {
     if (id == String() || !comp.is_valid()) return;
-    if (!has_component(id)) components[id] = comp;
+    if (has_component(id)) return;
+    components[id] = comp;
+    // summon scenes start loading in the background so the first cast does not hit the disk
+    SceneCache::get_singleton()->preload_component(comp);
 }
 
 void SpellComponentRegistry::unregister_component(const String &id) {
@@ -36,6 +40,7 @@ Ref<SpellComponent> SpellComponentRegistry::get_component(const String &id) cons
 }
 
 void SpellComponentRegistry::_bind_methods() {
+    ClassDB::bind_static_method("SpellComponentRegistry", D_METHOD("get_singleton"), &SpellComponentRegistry::get_singleton);
     ClassDB::bind_method(D_METHOD("register_component", "id", "component"), &SpellComponentRegistry::register_component);
     ClassDB::bind_method(D_METHOD("unregister_component", "id"), &SpellComponentRegistry::unregister_component);
     ClassDB::bind_method(D_METHOD("get_component_ids"), &SpellComponentRegistry::get_component_ids);
@@ -1,4 +1,5 @@
 #include "spellengine/synergy_registry.hpp"
+#include "spellengine/spell_log.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
@@ -20,11 +21,166 @@ SynergyRegistry *SynergyRegistry::get_singleton() {
 
 void SynergyRegistry::register_synergy(const String &key, const Dictionary &spec) {
     if (key == String()) return;
+    bool replacing = synergies.has(key);
     synergies[key] = spec;
+    revision += 1;
+    if (replacing) rebuild_index();
+    else index_synergy(key, spec);
 }
 
 void SynergyRegistry::unregister_synergy(const String &key) {
-    if (synergies.has(key)) synergies.erase(key);
+    if (synergies.has(key)) {
+        synergies.erase(key);
+        revision += 1;
+        rebuild_index();
+    }
+}
+
+int SynergyRegistry::intern_aspect(const String &aspect) {
+    String lower = aspect.to_lower();
+    auto it = aspect_ids.find(lower);
+    if (it != aspect_ids.end()) return it->second;
+    if (aspect_names.size() >= MAX_INDEXED_ASPECTS) return -1;
+    int id = aspect_names.size();
+    aspect_ids[lower] = id;
+    aspect_names.push_back(lower);
+    return id;
+}
+
+void SynergyRegistry::index_synergy(const String &key, const Dictionary &spec) {
+    // Prefer the declared component_aspects; otherwise treat a "+"-joined key as the aspect set.
+    Array aspects;
+    if (spec.has("component_aspects") && spec["component_aspects"].get_type() == Variant::ARRAY) {
+        Array carr = spec["component_aspects"];
+        for (int i = 0; i < carr.size(); ++i) {
+            if (carr[i].get_type() == Variant::STRING) aspects.push_back(carr[i]);
+        }
+    } else {
+        PackedStringArray parts = key.split("+", false);
+        for (int i = 0; i < parts.size(); ++i) aspects.push_back(parts[i]);
+    }
+    if (aspects.size() == 0) return;
+
+    MaskEntry e;
+    e.key = key;
+    e.combined_key = make_combined_key(aspects);
+    e.spec = spec;
+
+    uint64_t mask = 0;
+    for (int i = 0; i < aspects.size(); ++i) {
+        int id = intern_aspect(aspects[i]);
+        if (id < 0) {
+            // first registration for an aspect set wins here too
+            index_overflowed = true;
+            overflow_index.emplace(e.combined_key, e);
+            return;
+        }
+        mask |= (uint64_t)1 << id;
+    }
+    // first registration for an aspect set wins, matching alias registration semantics
+    if (mask_index.find(mask) != mask_index.end()) return;
+    mask_index[mask] = e;
+}
+
+void SynergyRegistry::rebuild_index() {
+    mask_index.clear();
+    overflow_index.clear();
+    // reassign bits from the remaining synergies so unregistered aspects free their slots
+    aspect_ids.clear();
+    aspect_names.clear();
+    index_overflowed = false;
+    Array keys = synergies.keys();
+    for (int i = 0; i < keys.size(); ++i) {
+        String k = keys[i];
+        index_synergy(k, synergies[k]);
+    }
+}
+
+String SynergyRegistry::make_combined_key(const Array &aspects) {
+    Array lower_aspects;
+    for (int i = 0; i < aspects.size(); ++i) {
+        Variant av = aspects[i];
+        if (av.get_type() != Variant::STRING && av.get_type() != Variant::STRING_NAME) continue;
+        lower_aspects.push_back(((String)av).to_lower());
+    }
+    lower_aspects.sort();
+    String combined = "";
+    for (int i = 0; i < lower_aspects.size(); ++i) {
+        // an aspect set, like its bitmask, ignores repeats
+        if (i && lower_aspects[i] == lower_aspects[i - 1]) continue;
+        if (i) combined += "+";
+        combined += (String)lower_aspects[i];
+    }
+    return combined;
+}
+
+int SynergyRegistry::get_aspect_id(const String &aspect) const {
+    // exact match first so already-lowercase ids (the common case) don't allocate
+    auto it = aspect_ids.find(aspect);
+    if (it != aspect_ids.end()) return it->second;
+    it = aspect_ids.find(aspect.to_lower());
+    if (it != aspect_ids.end()) return it->second;
+    return -1;
+}
+
+bool SynergyRegistry::get_aspect_mask(const Array &aspects, uint64_t &r_mask) const {
+    r_mask = 0;
+    for (int i = 0; i < aspects.size(); ++i) {
+        int id = get_aspect_id(aspects[i]);
+        if (id < 0) return false;
+        r_mask |= (uint64_t)1 << id;
+    }
+    return true;
+}
+
+bool SynergyRegistry::find_synergy_for_aspects(const Array &aspects, Dictionary &r_spec, String *r_combined_key) const {
+    if (aspects.size() == 0) return false;
+    uint64_t mask = 0;
+    if (get_aspect_mask(aspects, mask)) {
+        auto it = mask_index.find(mask);
+        if (it != mask_index.end()) {
+            r_spec = it->second.spec;
+            if (r_combined_key) *r_combined_key = it->second.combined_key;
+            return true;
+        }
+    }
+    if (!index_overflowed) return false;
+
+    // Slow path: some synergies were not indexable, look them up by combined key
+    auto oit = overflow_index.find(make_combined_key(aspects));
+    if (oit == overflow_index.end()) return false;
+    r_spec = oit->second.spec;
+    if (r_combined_key) *r_combined_key = oit->second.combined_key;
+    return true;
+}
+
+bool SynergyRegistry::find_synergy_for_aspect(const String &aspect, Dictionary &r_spec) const {
+    int id = get_aspect_id(aspect);
+    if (id >= 0) {
+        auto it = mask_index.find((uint64_t)1 << id);
+        if (it != mask_index.end()) {
+            r_spec = it->second.spec;
+            return true;
+        }
+    }
+    if (!index_overflowed) return false;
+
+    // Slow path: a single-aspect set's combined key is the lowercase aspect
+    auto oit = overflow_index.find(aspect.to_lower());
+    if (oit == overflow_index.end()) return false;
+    r_spec = oit->second.spec;
+    return true;
+}
+
+String SynergyRegistry::get_synergy_key_for_aspects(const Array &aspects) const {
+    Dictionary spec;
+    String combined;
+    if (!find_synergy_for_aspects(aspects, spec, &combined)) return String();
+    return combined;
+}
+
+int SynergyRegistry::get_synergy_count() const {
+    return synergies.size();
 }
 
 bool SynergyRegistry::has_synergy(const String &key) const {
@@ -40,12 +196,21 @@ Array SynergyRegistry::get_synergy_keys() const {
     return synergies.keys();
 }
 
+uint64_t SynergyRegistry::get_revision() const {
+    return revision;
+}
+
 void SynergyRegistry::_bind_methods() {
+    ClassDB::bind_static_method("SynergyRegistry", D_METHOD("get_singleton"), &SynergyRegistry::get_singleton);
     ClassDB::bind_method(D_METHOD("register_synergy", "key", "spec"), &SynergyRegistry::register_synergy);
     ClassDB::bind_method(D_METHOD("unregister_synergy", "key"), &SynergyRegistry::unregister_synergy);
     ClassDB::bind_method(D_METHOD("has_synergy", "key"), &SynergyRegistry::has_synergy);
     ClassDB::bind_method(D_METHOD("get_synergy", "key"), &SynergyRegistry::get_synergy);
     ClassDB::bind_method(D_METHOD("get_synergy_keys"), &SynergyRegistry::get_synergy_keys);
+    ClassDB::bind_method(D_METHOD("get_revision"), &SynergyRegistry::get_revision);
+    ClassDB::bind_method(D_METHOD("get_synergy_count"), &SynergyRegistry::get_synergy_count);
+    ClassDB::bind_method(D_METHOD("get_aspect_id", "aspect"), &SynergyRegistry::get_aspect_id);
+    ClassDB::bind_method(D_METHOD("get_synergy_key_for_aspects", "aspects"), &SynergyRegistry::get_synergy_key_for_aspects);
     ClassDB::bind_method(D_METHOD("register_from_path", "key", "resource_path"), &SynergyRegistry::register_from_path);
     ClassDB::bind_method(D_METHOD("load_all_from_dir", "dir_path", "recursive"), &SynergyRegistry::load_all_from_dir);
 
@@ -59,38 +224,25 @@ bool SynergyRegistry::register_from_path(const String &key, const String &resour
     Ref<Resource> r = ResourceLoader::get_singleton()->load(resource_path);
     using namespace godot;
     if (!r.is_valid()) {
-        UtilityFunctions::print(String("SynergyRegistry: failed to load resource: ") + resource_path);
+        SPELL_ERROR(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: failed to load resource: ") + resource_path);
         return false;
     }
     // Prefer strongly-typed Synergy resource
     Synergy *sres = Object::cast_to<Synergy>(r.ptr());
     if (sres) {
         Dictionary spec = sres->get_spec();
-        UtilityFunctions::print(String("SynergyRegistry: loaded Synergy resource spec from: ") + resource_path);
-        UtilityFunctions::print(spec);
+        SPELL_DEBUG(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: loaded Synergy resource spec from: ") + resource_path);
+        SPELL_TRACE(SpellLog::CHANNEL_REGISTRY, Variant(spec).stringify());
         register_synergy(key.to_lower(), spec);
         // If the Synergy resource declares component_aspects, also register an
         // alias key formed by sorting and lowercasing the aspect names joined by '+'.
         if (spec.has("component_aspects")) {
             Variant cav = spec["component_aspects"];
             if (cav.get_type() == Variant::ARRAY) {
-                Array carr = cav;
-                Array lower_aspects;
-                for (int i = 0; i < carr.size(); ++i) {
-                    Variant av = carr[i];
-                    if (av.get_type() != Variant::STRING) continue;
-                    String as = ((String)av).to_lower();
-                    lower_aspects.push_back(as);
-                }
-                lower_aspects.sort();
-                String alias = "";
-                for (int i = 0; i < lower_aspects.size(); ++i) {
-                    if (i) alias += "+";
-                    alias += (String)lower_aspects[i];
-                }
+                String alias = make_combined_key(cav);
                 if (alias != String() && !has_synergy(alias)) {
                     register_synergy(alias, spec);
-                    UtilityFunctions::print(String("SynergyRegistry: registered alias key for resource '") + key + "' -> '" + alias + "'");
+                    SPELL_DEBUG(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: registered alias key for resource '") + key + "' -> '" + alias + "'");
                 }
             }
         }
@@ -100,8 +252,8 @@ bool SynergyRegistry::register_from_path(const String &key, const String &resour
     // Fallback: try to read a `spec` property on generic Resource
     Variant spec = Object::cast_to<Object>(r.ptr())->get("spec");
     int t = spec.get_type();
-    UtilityFunctions::print(String("SynergyRegistry: resource spec type for: ") + resource_path + String(" = ") + String::num(t));
-    UtilityFunctions::print(spec);
+    SPELL_DEBUG(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: resource spec type for: ") + resource_path + String(" = ") + String::num(t));
+    SPELL_TRACE(SpellLog::CHANNEL_REGISTRY, Variant(spec).stringify());
     if (spec.get_type() == Variant::DICTIONARY) {
         // store synergies keyed by lowercase basename for predictable lookups
         register_synergy(key.to_lower(), spec);
@@ -110,29 +262,16 @@ bool SynergyRegistry::register_from_path(const String &key, const String &resour
         if (sdict.has("component_aspects")) {
             Variant cav = sdict["component_aspects"];
             if (cav.get_type() == Variant::ARRAY) {
-                Array carr = cav;
-                Array lower_aspects;
-                for (int i = 0; i < carr.size(); ++i) {
-                    Variant av = carr[i];
-                    if (av.get_type() != Variant::STRING) continue;
-                    String as = ((String)av).to_lower();
-                    lower_aspects.push_back(as);
-                }
-                lower_aspects.sort();
-                String alias = "";
-                for (int i = 0; i < lower_aspects.size(); ++i) {
-                    if (i) alias += "+";
-                    alias += (String)lower_aspects[i];
-                }
+                String alias = make_combined_key(cav);
                 if (alias != String() && !has_synergy(alias)) {
                     register_synergy(alias, spec);
-                    UtilityFunctions::print(String("SynergyRegistry: registered alias key for resource '") + key + "' -> '" + alias + "'");
+                    SPELL_DEBUG(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: registered alias key for resource '") + key + "' -> '" + alias + "'");
                 }
             }
         }
         return true;
     }
-    UtilityFunctions::print(String("SynergyRegistry: resource did not contain 'spec' dict: ") + resource_path);
+    SPELL_WARN(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: resource did not contain 'spec' dict: ") + resource_path);
     return false;
 }
 
@@ -140,15 +279,15 @@ int SynergyRegistry::load_all_from_dir(const String &dir_path, bool recursive) {
     Ref<DirAccess> dir = DirAccess::open(dir_path);
     using namespace godot;
     if (!dir.is_valid()) {
-        UtilityFunctions::print(String("SynergyRegistry: cannot open dir: ") + dir_path);
+        SPELL_WARN(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: cannot open dir: ") + dir_path);
         return 0;
     }
-    UtilityFunctions::print(String("SynergyRegistry: scanning dir: ") + dir_path);
+    SPELL_DEBUG(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: scanning dir: ") + dir_path);
     int registered = 0;
     dir->list_dir_begin();
     String fname = dir->get_next();
     while (fname != String()) {
-        UtilityFunctions::print(String("SynergyRegistry: found entry: ") + fname + (dir->current_is_dir() ? " (dir)" : ""));
+        SPELL_TRACE(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: found entry: ") + fname + (dir->current_is_dir() ? " (dir)" : ""));
         if (dir->current_is_dir()) {
             if (recursive) {
                 String subdir = dir_path + String("/") + fname;
@@ -159,12 +298,12 @@ int SynergyRegistry::load_all_from_dir(const String &dir_path, bool recursive) {
             if (lower.ends_with(".json") || lower.ends_with(".tres") || lower.ends_with(".res")) {
                 String key = fname.get_basename().to_lower();
                 String full = dir_path + String("/") + fname;
-                UtilityFunctions::print(String("SynergyRegistry: attempting to register from: ") + full + String(" as key=") + key);
+                SPELL_DEBUG(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: attempting to register from: ") + full + String(" as key=") + key);
                 if (register_from_path(key, full)) {
                     registered++;
-                    UtilityFunctions::print(String("SynergyRegistry: registered synergy: ") + key);
+                    SPELL_INFO(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: registered synergy: ") + key);
                 } else {
-                    UtilityFunctions::print(String("SynergyRegistry: failed to register synergy from: ") + full);
+                    SPELL_WARN(SpellLog::CHANNEL_REGISTRY, String("SynergyRegistry: failed to register synergy from: ") + full);
                 }
             }
         }
@@ -10,6 +10,7 @@ String SpellComponent::get_executor_id() const {
 
 void SpellComponent::set_executor_id(const String &p_id) {
     executor_id = p_id;
+    version += 1;
 }
 
 int SpellComponent::get_priority() const {
@@ -18,6 +19,7 @@ int SpellComponent::get_priority() const {
 
 void SpellComponent::set_priority(int p) {
     priority = p;
+    version += 1;
 }
 
 double SpellComponent::get_cost() const {
@@ -26,6 +28,7 @@ double SpellComponent::get_cost() const {
 
 void SpellComponent::set_cost(double c) {
     cost = c;
+    version += 1;
 }
 
 Dictionary SpellComponent::get_params() const {
@@ -35,6 +38,7 @@ Dictionary SpellComponent::get_params() const {
 
 void SpellComponent::set_params(const Dictionary &p_params) {
     base_params = p_params;
+    version += 1;
 }
 
 Dictionary SpellComponent::get_base_params() const {
@@ -43,6 +47,7 @@ Dictionary SpellComponent::get_base_params() const {
 
 void SpellComponent::set_base_params(const Dictionary &p) {
     base_params = p;
+    version += 1;
 }
 
 Dictionary SpellComponent::get_aspects_contributions() const {
@@ -51,6 +56,7 @@ Dictionary SpellComponent::get_aspects_contributions() const {
 
 void SpellComponent::set_aspects_contributions(const Dictionary &d) {
     aspects_contributions = d;
+    version += 1;
 }
 
 Dictionary SpellComponent::get_aspect_modifiers() const {
@@ -59,6 +65,7 @@ Dictionary SpellComponent::get_aspect_modifiers() const {
 
 void SpellComponent::set_aspect_modifiers(const Dictionary &d) {
     aspect_modifiers = d;
+    version += 1;
 }
 
 Dictionary SpellComponent::get_synergy_modifiers() const {
@@ -67,6 +74,15 @@ Dictionary SpellComponent::get_synergy_modifiers() const {
 
 void SpellComponent::set_synergy_modifiers(const Dictionary &d) {
     synergy_modifiers = d;
+    version += 1;
+}
+
+uint64_t SpellComponent::get_version() const {
+    return version;
+}
+
+void SpellComponent::mark_changed() {
+    version += 1;
 }
 
 void SpellComponent::_bind_methods() {
@@ -101,4 +117,7 @@ void SpellComponent::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_synergy_modifiers"), &SpellComponent::get_synergy_modifiers);
     ClassDB::bind_method(D_METHOD("set_synergy_modifiers", "mods"), &SpellComponent::set_synergy_modifiers);
     ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "synergy_modifiers"), "set_synergy_modifiers", "get_synergy_modifiers");
+
+    ClassDB::bind_method(D_METHOD("get_version"), &SpellComponent::get_version);
+    ClassDB::bind_method(D_METHOD("mark_changed"), &SpellComponent::mark_changed);
 }
@@ -0,0 +1,77 @@
+#include "spellengine/compiled_spell.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include "spellengine/executor_registry.hpp"
+
+using namespace godot;
+
+bool CompiledSpell::is_control_executor_id(const String &exec_id) {
+    return exec_id.begins_with("choose_") || exec_id.begins_with("select_");
+}
+
+void CompiledSpell::compile(const TypedArray<Ref<SpellComponent>> &components) {
+    steps.clear();
+    source_components.clear();
+    first_control_index = -1;
+
+    ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
+    registry_revision = reg ? reg->get_revision() : 0;
+
+    steps.reserve(components.size());
+    source_components.reserve(components.size());
+    for (int i = 0; i < components.size(); ++i) {
+        Ref<SpellComponent> comp = components[i];
+        source_components.push_back(comp.ptr());
+        if (!comp.is_valid()) continue;
+
+        Step step;
+        step.component = comp;
+        step.executor_id = comp->get_executor_id();
+        step.source_index = i;
+        step.is_control = is_control_executor_id(step.executor_id);
+        if (reg && reg->has_executor(step.executor_id)) step.executor = reg->get_executor(step.executor_id);
+        if (step.is_control && first_control_index < 0) first_control_index = i;
+        steps.push_back(step);
+    }
+}
+
+bool CompiledSpell::is_current_for(const TypedArray<Ref<SpellComponent>> &components) const {
+    ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
+    if (reg && reg->get_revision() != registry_revision) return false;
+    if ((size_t)components.size() != source_components.size()) return false;
+    // steps are stored in source order, so walk them alongside the components
+    size_t s = 0;
+    for (int i = 0; i < components.size(); ++i) {
+        Ref<SpellComponent> comp = components[i];
+        if (comp.ptr() != source_components[i]) return false;
+        if (!comp.is_valid()) continue;
+        // executor ids are editable on the component resource, so re-check them
+        if (s >= steps.size() || steps[s].executor_id != comp->get_executor_id()) return false;
+        ++s;
+    }
+    return true;
+}
+
+int CompiledSpell::get_step_count() const {
+    return (int)steps.size();
+}
+
+int CompiledSpell::get_source_component_count() const {
+    return (int)source_components.size();
+}
+
+int CompiledSpell::get_first_control_index() const {
+    return first_control_index;
+}
+
+Array CompiledSpell::get_executor_ids() const {
+    Array out;
+    for (size_t i = 0; i < steps.size(); ++i) out.push_back(steps[i].executor_id);
+    return out;
+}
+
+void CompiledSpell::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("get_step_count"), &CompiledSpell::get_step_count);
+    ClassDB::bind_method(D_METHOD("get_first_control_index"), &CompiledSpell::get_first_control_index);
+    ClassDB::bind_method(D_METHOD("get_executor_ids"), &CompiledSpell::get_executor_ids);
+}
@@ -0,0 +1,91 @@
+#include "spellengine/damage_accumulator.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/spell_target.hpp"
+#include "spellengine/target_capabilities.hpp"
+
+#include <godot_cpp/variant/array.hpp>
+
+using namespace godot;
+
+int DamageAccumulator::depth = 0;
+std::vector<DamageAccumulator::TargetHits> DamageAccumulator::pending;
+std::unordered_map<uint64_t, size_t> DamageAccumulator::pending_index;
+
+// Bounds flush rounds when delivering damage causes more damage (e.g. reflect effects)
+static constexpr int MAX_FLUSH_ROUNDS = 16;
+
+void DamageAccumulator::add_hit(Object *target, double amount, const String &aspect, const Dictionary &meta) {
+    if (!target) return;
+    if (depth == 0) {
+        std::vector<Hit> single{ Hit{ amount, aspect, meta } };
+        deliver(target, single);
+        return;
+    }
+    const uint64_t id = target->get_instance_id();
+    auto it = pending_index.find(id);
+    if (it == pending_index.end()) {
+        pending_index[id] = pending.size();
+        pending.push_back(TargetHits{ id, {} });
+        pending.back().hits.push_back(Hit{ amount, aspect, meta });
+    } else {
+        pending[it->second].hits.push_back(Hit{ amount, aspect, meta });
+    }
+}
+
+void DamageAccumulator::begin() {
+    depth += 1;
+}
+
+void DamageAccumulator::end() {
+    if (depth <= 0) {
+        SPELL_WARN(SpellLog::CHANNEL_EXECUTOR, "DamageAccumulator: end() without matching begin()");
+        return;
+    }
+    if (depth == 1) flush();
+    depth -= 1;
+}
+
+void DamageAccumulator::flush() {
+    // keep depth raised while delivering so damage caused by targets is queued for the next round
+    depth += 1;
+    for (int round = 0; round < MAX_FLUSH_ROUNDS && !pending.empty(); ++round) {
+        std::vector<TargetHits> batch;
+        batch.swap(pending);
+        pending_index.clear();
+        for (const TargetHits &t : batch) {
+            Object *obj = ObjectDB::get_instance(t.target_id);
+            if (obj) deliver(obj, t.hits);
+        }
+    }
+    if (!pending.empty()) {
+        SPELL_WARN(SpellLog::CHANNEL_EXECUTOR, String("DamageAccumulator: dropping ") + String::num_int64((int64_t)pending.size()) + " targets' hits after repeated re-entrant damage");
+        pending.clear();
+        pending_index.clear();
+    }
+    depth -= 1;
+}
+
+void DamageAccumulator::deliver(Object *obj, const std::vector<Hit> &hits) {
+    // native targets are queued only to keep their order relative to script targets
+    if (SpellTarget *st = SpellTarget::from_object(obj)) {
+        for (const Hit &hit : hits) st->apply_damage(hit.amount, hit.aspect, hit.meta);
+        return;
+    }
+    const uint32_t caps = TargetCapabilities::get(obj);
+    if (caps & TargetCapabilities::APPLY_DAMAGE_BATCH) {
+        Array packets;
+        packets.resize((int64_t)hits.size());
+        for (size_t i = 0; i < hits.size(); ++i) {
+            Dictionary packet;
+            packet["amount"] = hits[i].amount;
+            packet["aspect"] = hits[i].aspect;
+            packet["meta"] = hits[i].meta;
+            packets[(int64_t)i] = packet;
+        }
+        obj->call("apply_damage_batch", packets);
+        return;
+    }
+    if (caps & TargetCapabilities::APPLY_DAMAGE) {
+        for (const Hit &hit : hits) obj->call("apply_damage", hit.amount, hit.aspect, hit.meta);
+    }
+}
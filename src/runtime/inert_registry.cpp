@@ -0,0 +1,58 @@
+#include "spellengine/inert_registry.hpp"
+
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/classes/rigid_body3d.hpp>
+
+using namespace godot;
+
+std::unordered_map<uint64_t, InertRegistry::Entry> InertRegistry::entries;
+size_t InertRegistry::prune_at = 256;
+
+void InertRegistry::prune() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (ObjectDB::get_instance(it->first)) ++it;
+        else it = entries.erase(it);
+    }
+    prune_at = entries.size() * 2 > 256 ? entries.size() * 2 : 256;
+}
+
+void InertRegistry::mark(Node *node) {
+    if (!node) return;
+    if (entries.size() >= prune_at) prune();
+    auto existing = entries.find(node->get_instance_id());
+    // marking twice must not record the parked state as the authored one
+    if (existing != entries.end()) return;
+    Entry e;
+    RigidBody3D *rb = Object::cast_to<RigidBody3D>(node);
+    if (rb) {
+        e.body = true;
+        e.authored_freeze = rb->is_freeze_enabled();
+        // static or kinematic according to the body's own freeze_mode
+        rb->set_freeze_enabled(true);
+    } else {
+        node->set_physics_process(false);
+    }
+    entries[node->get_instance_id()] = e;
+}
+
+bool InertRegistry::is_inert(uint64_t instance_id) {
+    return entries.find(instance_id) != entries.end();
+}
+
+void InertRegistry::restore(Node *node, const Entry &e) {
+    if (!e.body) {
+        node->set_physics_process(true);
+        return;
+    }
+    RigidBody3D *rb = Object::cast_to<RigidBody3D>(node);
+    if (rb) rb->set_freeze_enabled(e.authored_freeze);
+}
+
+bool InertRegistry::activate(Node *node) {
+    if (!node) return false;
+    auto it = entries.find(node->get_instance_id());
+    if (it == entries.end()) return false;
+    restore(node, it->second);
+    entries.erase(it);
+    return true;
+}
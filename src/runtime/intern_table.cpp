@@ -0,0 +1,59 @@
+#include "spellengine/intern_table.hpp"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <mutex>
+
+using namespace godot;
+
+int InternTable::find_locked(const String &name) const {
+    auto it = ids.find(name);
+    if (it != ids.end()) return it->second;
+    if (fold_case) {
+        it = ids.find(name.to_lower());
+        if (it != ids.end()) return it->second;
+    }
+    return -1;
+}
+
+int InternTable::intern(const String &name) {
+    {
+        std::shared_lock<std::shared_mutex> read(lock);
+        auto it = ids.find(name);
+        if (it != ids.end()) return it->second;
+    }
+    std::unique_lock<std::shared_mutex> write(lock);
+    // another thread may have added it between the two locks
+    int id = find_locked(name);
+    if (id >= 0) {
+        // remember this spelling so the next lookup hits the exact-match path
+        ids.emplace(name, id);
+        return id;
+    }
+    id = count.load(std::memory_order_relaxed);
+    CRASH_COND_MSG(id >= MAX_CHUNKS * CHUNK_SIZE, "InternTable: too many distinct names.");
+    std::unique_ptr<String[]> &chunk = chunks[id >> CHUNK_BITS];
+    if (!chunk) chunk.reset(new String[CHUNK_SIZE]);
+    const String key = fold_case ? name.to_lower() : name;
+    chunk[id & (CHUNK_SIZE - 1)] = key;
+    ids.emplace(key, id);
+    if (key != name) ids.emplace(name, id);
+    // publish the name before the id can be observed through size()
+    count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+int InternTable::find(const String &name) const {
+    std::shared_lock<std::shared_mutex> read(lock);
+    return find_locked(name);
+}
+
+// Function-static tables avoid static-initialization-order issues (see ExecutorRegistry factories)
+InternTable &InternTable::aspects() {
+    static InternTable table(true);
+    return table;
+}
+
+InternTable &InternTable::params() {
+    static InternTable table;
+    return table;
+}
@@ -0,0 +1,177 @@
+#include "spellengine/multimesh_batcher.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/classes/mesh_instance3d.hpp>
+
+using namespace godot;
+
+MultiMeshBatcher *MultiMeshBatcher::singleton = nullptr;
+
+static const char *META_BATCHED = "spell_multimesh";
+
+MultiMeshBatcher::MultiMeshBatcher() {
+    set_process(true);
+}
+
+MultiMeshBatcher::~MultiMeshBatcher() {
+    if (singleton == this) singleton = nullptr;
+}
+
+MultiMeshBatcher *MultiMeshBatcher::get_singleton() {
+    if (singleton) return singleton;
+    Engine *engine = Engine::get_singleton();
+    SceneTree *tree = engine ? Object::cast_to<SceneTree>(engine->get_main_loop()) : nullptr;
+    if (!tree || !tree->get_root()) return nullptr;
+    singleton = memnew(MultiMeshBatcher);
+    singleton->set_name("MultiMeshBatcher");
+    // deferred: executors may run while the root is busy adding or removing children
+    tree->get_root()->call_deferred("add_child", singleton);
+    return singleton;
+}
+
+void MultiMeshBatcher::_process(double delta) {
+    flush();
+}
+
+MultiMeshBatcher::Batch &MultiMeshBatcher::batch_for(const Ref<Mesh> &mesh) {
+    Batch &batch = batches[mesh->get_instance_id()];
+    if (!batch.node) {
+        batch.mesh = mesh;
+        batch.multimesh.instantiate();
+        batch.multimesh->set_transform_format(MultiMesh::TRANSFORM_3D);
+        batch.multimesh->set_mesh(mesh);
+        batch.node = memnew(MultiMeshInstance3D);
+        batch.node->set_multimesh(batch.multimesh);
+        add_child(batch.node);
+    }
+    return batch;
+}
+
+static MeshInstance3D *find_mesh_instance(Node *node) {
+    MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(node);
+    if (mi && mi->get_mesh().is_valid()) return mi;
+    for (int i = 0; i < node->get_child_count(); ++i) {
+        mi = find_mesh_instance(node->get_child(i));
+        if (mi) return mi;
+    }
+    return nullptr;
+}
+
+bool MultiMeshBatcher::track_node(Node *node) {
+    if (!node) return false;
+    MeshInstance3D *mi = find_mesh_instance(node);
+    if (!mi) return false;
+    // pooled summons are tracked again on reuse
+    if (mi->has_meta(META_BATCHED)) return true;
+    Batch &batch = batch_for(mi->get_mesh());
+    batch.tracked_ids.push_back(mi->get_instance_id());
+    mi->set_meta(META_BATCHED, true);
+    mi->set_visible(false);
+    return true;
+}
+
+void MultiMeshBatcher::untrack_node(Node *node) {
+    if (!node) return;
+    MeshInstance3D *mi = find_mesh_instance(node);
+    if (!mi || !mi->has_meta(META_BATCHED)) return;
+    auto it = batches.find(mi->get_mesh()->get_instance_id());
+    if (it != batches.end()) {
+        std::vector<uint64_t> &ids = it->second.tracked_ids;
+        const uint64_t id = mi->get_instance_id();
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (ids[i] != id) continue;
+            ids[i] = ids.back();
+            ids.pop_back();
+            break;
+        }
+    }
+    mi->remove_meta(META_BATCHED);
+    mi->set_visible(true);
+}
+
+void MultiMeshBatcher::set_transforms(const Ref<Mesh> &mesh, const std::vector<Transform3D> &transforms) {
+    if (!mesh.is_valid()) return;
+    if (transforms.empty() && batches.find(mesh->get_instance_id()) == batches.end()) return;
+    batch_for(mesh).native = transforms;
+}
+
+static inline void write_transform(float *dst, const Transform3D &t) {
+    // TRANSFORM_3D layout: three basis rows, each followed by that row's origin component
+    for (int r = 0; r < 3; ++r) {
+        dst[r * 4 + 0] = (float)t.basis.rows[r].x;
+        dst[r * 4 + 1] = (float)t.basis.rows[r].y;
+        dst[r * 4 + 2] = (float)t.basis.rows[r].z;
+        dst[r * 4 + 3] = (float)t.origin[r];
+    }
+}
+
+void MultiMeshBatcher::upload(Batch &batch) {
+    // drop freed nodes; nodes outside the tree (e.g. pooled) are kept but not drawn
+    size_t live = 0;
+    for (size_t i = 0; i < batch.tracked_ids.size(); ++i) {
+        if (!ObjectDB::get_instance(batch.tracked_ids[i])) continue;
+        batch.tracked_ids[live++] = batch.tracked_ids[i];
+    }
+    batch.tracked_ids.resize(live);
+
+    const int wanted = (int)(batch.native.size() + batch.tracked_ids.size());
+    if (wanted > batch.capacity) {
+        int cap = batch.capacity > 0 ? batch.capacity : 16;
+        while (cap < wanted) cap *= 2;
+        batch.capacity = cap;
+        batch.multimesh->set_instance_count(cap);
+        batch.buffer.resize((int64_t)cap * 12);
+    }
+
+    float *dst = batch.buffer.ptrw();
+    int count = 0;
+    for (const Transform3D &t : batch.native) write_transform(dst + (size_t)count++ * 12, t);
+    for (uint64_t id : batch.tracked_ids) {
+        MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(id));
+        if (!mi || !mi->is_inside_tree()) continue;
+        write_transform(dst + (size_t)count++ * 12, mi->get_global_transform());
+    }
+    if (batch.capacity > 0) batch.multimesh->set_buffer(batch.buffer);
+    batch.multimesh->set_visible_instance_count(count);
+}
+
+void MultiMeshBatcher::flush() {
+    for (auto &kv : batches) upload(kv.second);
+}
+
+void MultiMeshBatcher::clear() {
+    for (auto &kv : batches) {
+        for (uint64_t id : kv.second.tracked_ids) {
+            MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(id));
+            if (!mi) continue;
+            mi->remove_meta(META_BATCHED);
+            mi->set_visible(true);
+        }
+        if (kv.second.node) kv.second.node->queue_free();
+    }
+    batches.clear();
+}
+
+int MultiMeshBatcher::get_batch_count() const {
+    return (int)batches.size();
+}
+
+int MultiMeshBatcher::get_visible_count(const Ref<Mesh> &mesh) const {
+    if (!mesh.is_valid()) return 0;
+    auto it = batches.find(mesh->get_instance_id());
+    return it == batches.end() ? 0 : it->second.multimesh->get_visible_instance_count();
+}
+
+void MultiMeshBatcher::_bind_methods() {
+    ClassDB::bind_static_method("MultiMeshBatcher", D_METHOD("get_singleton"), &MultiMeshBatcher::get_singleton);
+    ClassDB::bind_method(D_METHOD("track_node", "node"), &MultiMeshBatcher::track_node);
+    ClassDB::bind_method(D_METHOD("untrack_node", "node"), &MultiMeshBatcher::untrack_node);
+    ClassDB::bind_method(D_METHOD("flush"), &MultiMeshBatcher::flush);
+    ClassDB::bind_method(D_METHOD("clear"), &MultiMeshBatcher::clear);
+    ClassDB::bind_method(D_METHOD("get_batch_count"), &MultiMeshBatcher::get_batch_count);
+    ClassDB::bind_method(D_METHOD("get_visible_count", "mesh"), &MultiMeshBatcher::get_visible_count);
+}
@@ -0,0 +1,195 @@
+#include "spellengine/param_block.hpp"
+
+#include <godot_cpp/variant/vector2.hpp>
+#include "spellengine/intern_table.hpp"
+
+using namespace godot;
+
+int ParamBlock::key(const String &name) {
+    return InternTable::params().intern(name);
+}
+
+const ParamBlock::Entry *ParamBlock::find_entry(int key) const {
+    if (key < 0) return nullptr;
+    int inline_count = count < INLINE_CAPACITY ? count : INLINE_CAPACITY;
+    for (int i = 0; i < inline_count; ++i) {
+        if (inline_entries[i].key == key) return &inline_entries[i];
+    }
+    for (size_t i = 0; i < overflow.size(); ++i) {
+        if (overflow[i].key == key) return &overflow[i];
+    }
+    return nullptr;
+}
+
+ParamBlock::Entry &ParamBlock::entry_for_write(int key) {
+    Entry *existing = const_cast<Entry *>(find_entry(key));
+    if (existing) {
+        existing->other = Variant();
+        return *existing;
+    }
+    Entry *e;
+    if (count < INLINE_CAPACITY) {
+        e = &inline_entries[count];
+    } else {
+        overflow.push_back(Entry());
+        e = &overflow.back();
+    }
+    count += 1;
+    e->key = key;
+    return *e;
+}
+
+bool ParamBlock::has(const String &name) const {
+    return find_entry(InternTable::params().find(name)) != nullptr;
+}
+
+void ParamBlock::clear() {
+    for (int i = 0; i < count && i < INLINE_CAPACITY; ++i) inline_entries[i] = Entry();
+    overflow.clear();
+    count = 0;
+}
+
+void ParamBlock::set_bool(int key, bool value) {
+    Entry &e = entry_for_write(key);
+    e.type = TYPE_BOOL;
+    e.num.b = value;
+}
+
+void ParamBlock::set_int(int key, int64_t value) {
+    Entry &e = entry_for_write(key);
+    e.type = TYPE_INT;
+    e.num.i = value;
+}
+
+void ParamBlock::set_float(int key, double value) {
+    Entry &e = entry_for_write(key);
+    e.type = TYPE_FLOAT;
+    e.num.f = value;
+}
+
+void ParamBlock::set_vector3(int key, const Vector3 &value) {
+    Entry &e = entry_for_write(key);
+    e.type = TYPE_VECTOR3;
+    e.vec = value;
+}
+
+void ParamBlock::set(int key, const Variant &value) {
+    switch (value.get_type()) {
+        case Variant::BOOL:
+            set_bool(key, (bool)value);
+            return;
+        case Variant::INT:
+            set_int(key, (int64_t)value);
+            return;
+        case Variant::FLOAT:
+            set_float(key, (double)value);
+            return;
+        case Variant::VECTOR3:
+            set_vector3(key, (Vector3)value);
+            return;
+        case Variant::VECTOR2: {
+            Vector2 v2 = value;
+            Entry &e = entry_for_write(key);
+            e.type = TYPE_VECTOR2;
+            e.vec = Vector3(v2.x, v2.y, 0);
+            return;
+        }
+        default: {
+            Entry &e = entry_for_write(key);
+            e.type = TYPE_VARIANT;
+            e.other = value;
+            return;
+        }
+    }
+}
+
+bool ParamBlock::get_bool(int key, bool def) const {
+    const Entry *e = find_entry(key);
+    if (!e) return def;
+    switch (e->type) {
+        case TYPE_BOOL: return e->num.b;
+        case TYPE_INT: return e->num.i != 0;
+        case TYPE_FLOAT: return e->num.f != 0.0;
+        default: return def;
+    }
+}
+
+int64_t ParamBlock::get_int(int key, int64_t def) const {
+    const Entry *e = find_entry(key);
+    if (!e) return def;
+    switch (e->type) {
+        case TYPE_INT: return e->num.i;
+        case TYPE_FLOAT: return (int64_t)e->num.f;
+        case TYPE_BOOL: return e->num.b ? 1 : 0;
+        default: return def;
+    }
+}
+
+double ParamBlock::get_float(int key, double def) const {
+    const Entry *e = find_entry(key);
+    if (!e) return def;
+    switch (e->type) {
+        case TYPE_FLOAT: return e->num.f;
+        case TYPE_INT: return (double)e->num.i;
+        case TYPE_BOOL: return e->num.b ? 1.0 : 0.0;
+        default: return def;
+    }
+}
+
+Vector3 ParamBlock::get_vector3(int key, const Vector3 &def) const {
+    const Entry *e = find_entry(key);
+    if (!e) return def;
+    if (e->type == TYPE_VECTOR3 || e->type == TYPE_VECTOR2) return e->vec;
+    return def;
+}
+
+String ParamBlock::get_string(int key, const String &def) const {
+    const Entry *e = find_entry(key);
+    if (!e || e->type != TYPE_VARIANT) return def;
+    Variant::Type t = e->other.get_type();
+    if (t != Variant::STRING && t != Variant::STRING_NAME) return def;
+    return e->other;
+}
+
+Variant ParamBlock::entry_value(const Entry &e) {
+    switch (e.type) {
+        case TYPE_BOOL: return e.num.b;
+        case TYPE_INT: return e.num.i;
+        case TYPE_FLOAT: return e.num.f;
+        case TYPE_VECTOR2: return Vector2(e.vec.x, e.vec.y);
+        case TYPE_VECTOR3: return e.vec;
+        default: return e.other;
+    }
+}
+
+Variant ParamBlock::get(int key, const Variant &def) const {
+    const Entry *e = find_entry(key);
+    if (!e) return def;
+    return entry_value(*e);
+}
+
+void ParamBlock::merge_dictionary(const Dictionary &values) {
+    Array keys = values.keys();
+    for (int i = 0; i < keys.size(); ++i) {
+        Variant k = keys[i];
+        set((String)k, values[k]);
+    }
+}
+
+ParamBlock ParamBlock::from_dictionary(const Dictionary &values) {
+    ParamBlock block;
+    block.merge_dictionary(values);
+    return block;
+}
+
+Dictionary ParamBlock::to_dictionary() const {
+    Dictionary out;
+    const InternTable &params = InternTable::params();
+    for (int i = 0; i < count && i < INLINE_CAPACITY; ++i) {
+        out[params.get_name(inline_entries[i].key)] = entry_value(inline_entries[i]);
+    }
+    for (size_t i = 0; i < overflow.size(); ++i) {
+        out[params.get_name(overflow[i].key)] = entry_value(overflow[i]);
+    }
+    return out;
+}
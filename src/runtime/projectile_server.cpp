@@ -0,0 +1,344 @@
+#include "spellengine/projectile_server.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/damage_accumulator.hpp"
+#include "spellengine/spell_stats.hpp"
+#include "spellengine/spell_engine.hpp"
+#include "spellengine/spell_context.hpp"
+#include "spellengine/spell_caster.hpp"
+#include "spellengine/multimesh_batcher.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/classes/world3d.hpp>
+#include <godot_cpp/classes/collision_object3d.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+using namespace godot;
+
+ProjectileServer *ProjectileServer::singleton = nullptr;
+
+ProjectileServer::ProjectileServer() {
+    set_physics_process(true);
+}
+
+ProjectileServer::~ProjectileServer() {
+    SpellStats::projectiles_live.fetch_sub((int64_t)handles.size(), std::memory_order_relaxed);
+    if (default_impact_engine) memdelete(default_impact_engine);
+    if (singleton == this) singleton = nullptr;
+}
+
+ProjectileServer *ProjectileServer::get_singleton() {
+    if (singleton) return singleton;
+    Engine *engine = Engine::get_singleton();
+    SceneTree *tree = engine ? Object::cast_to<SceneTree>(engine->get_main_loop()) : nullptr;
+    if (!tree || !tree->get_root()) return nullptr;
+    singleton = memnew(ProjectileServer);
+    singleton->set_name("ProjectileServer");
+    // deferred: executors may run while the root is busy adding or removing children
+    tree->get_root()->call_deferred("add_child", singleton);
+    return singleton;
+}
+
+void ProjectileServer::_physics_process(double delta) {
+    advance(delta);
+}
+
+int64_t ProjectileServer::spawn(const Vector3 &origin, const Vector3 &velocity, double lifetime, double radius, const Vector3 &gravity, int64_t collision_mask, Node *caster, const Ref<Spell> &impact_spell, const Dictionary &meta, const Ref<Mesh> &mesh) {
+    const int64_t handle = next_handle++;
+    handle_index[handle] = handles.size();
+    handles.push_back(handle);
+    positions.push_back(origin);
+    velocities.push_back(velocity);
+    gravities.push_back(gravity);
+    radii.push_back(radius > 0.0 ? (float)radius : 0.0f);
+    remaining.push_back(lifetime);
+    collision_masks.push_back((uint32_t)collision_mask);
+    caster_ids.push_back(caster ? caster->get_instance_id() : 0);
+    // exclude the caster's own body, which is usually an ancestor of its SpellCaster node
+    CollisionObject3D *body = SpellCaster::find_self_or_ancestor<CollisionObject3D>(caster);
+    caster_rids.push_back(body ? body->get_rid() : RID());
+    impact_spells.push_back(impact_spell);
+    metadata.push_back(meta);
+    meshes.push_back(mesh);
+    SpellStats::projectiles_live.fetch_add(1, std::memory_order_relaxed);
+    return handle;
+}
+
+void ProjectileServer::remove_at(size_t index) {
+    const size_t last = handles.size() - 1;
+    handle_index.erase(handles[index]);
+    if (index != last) {
+        handles[index] = handles[last];
+        positions[index] = positions[last];
+        velocities[index] = velocities[last];
+        gravities[index] = gravities[last];
+        radii[index] = radii[last];
+        remaining[index] = remaining[last];
+        collision_masks[index] = collision_masks[last];
+        caster_ids[index] = caster_ids[last];
+        caster_rids[index] = caster_rids[last];
+        impact_spells[index] = impact_spells[last];
+        metadata[index] = metadata[last];
+        meshes[index] = meshes[last];
+        handle_index[handles[index]] = index;
+    }
+    handles.pop_back();
+    positions.pop_back();
+    velocities.pop_back();
+    gravities.pop_back();
+    radii.pop_back();
+    remaining.pop_back();
+    collision_masks.pop_back();
+    caster_ids.pop_back();
+    caster_rids.pop_back();
+    impact_spells.pop_back();
+    metadata.pop_back();
+    meshes.pop_back();
+    SpellStats::projectiles_live.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool ProjectileServer::remove(int64_t handle) {
+    auto it = handle_index.find(handle);
+    if (it == handle_index.end()) return false;
+    remove_at(it->second);
+    return true;
+}
+
+void ProjectileServer::clear() {
+    SpellStats::projectiles_live.fetch_sub((int64_t)handles.size(), std::memory_order_relaxed);
+    handles.clear();
+    positions.clear();
+    velocities.clear();
+    gravities.clear();
+    radii.clear();
+    remaining.clear();
+    collision_masks.clear();
+    caster_ids.clear();
+    caster_rids.clear();
+    impact_spells.clear();
+    metadata.clear();
+    meshes.clear();
+    handle_index.clear();
+    publish_visuals();
+}
+
+int ProjectileServer::get_count() const {
+    return (int)handles.size();
+}
+
+bool ProjectileServer::has_projectile(int64_t handle) const {
+    return handle_index.find(handle) != handle_index.end();
+}
+
+Vector3 ProjectileServer::get_position(int64_t handle) const {
+    auto it = handle_index.find(handle);
+    return it == handle_index.end() ? Vector3() : positions[it->second];
+}
+
+Vector3 ProjectileServer::get_velocity(int64_t handle) const {
+    auto it = handle_index.find(handle);
+    return it == handle_index.end() ? Vector3() : velocities[it->second];
+}
+
+void ProjectileServer::set_excluded(const RID &rid) {
+    // exclusion lists are arrays on the query objects, so only rebuild them when the caster changes
+    if (rid == last_excluded) return;
+    last_excluded = rid;
+    TypedArray<RID> exclude;
+    if (rid.is_valid()) exclude.append(rid);
+    ray_query->set_exclude(exclude);
+    shape_query->set_exclude(exclude);
+}
+
+bool ProjectileServer::sweep(PhysicsDirectSpaceState3D *space, size_t i, const Vector3 &motion, PendingImpact &out) {
+    set_excluded(caster_rids[i]);
+    const Vector3 from = positions[i];
+    Dictionary hit;
+    if (radii[i] <= 0.0f) {
+        ray_query->set_from(from);
+        ray_query->set_to(from + motion);
+        ray_query->set_collision_mask(collision_masks[i]);
+        hit = space->intersect_ray(ray_query);
+        if (hit.is_empty()) return false;
+        out.position = hit["position"];
+    } else {
+        if (sphere->get_radius() != radii[i]) sphere->set_radius(radii[i]);
+        shape_query->set_transform(Transform3D(Basis(), from));
+        shape_query->set_motion(motion);
+        shape_query->set_collision_mask(collision_masks[i]);
+        PackedFloat32Array fractions = space->cast_motion(shape_query);
+        if (fractions.size() < 2 || fractions[1] >= 1.0f) return false;
+        // rest info at the first touching position names the collider and contact
+        shape_query->set_transform(Transform3D(Basis(), from + motion * fractions[1]));
+        shape_query->set_motion(Vector3());
+        hit = space->get_rest_info(shape_query);
+        if (hit.is_empty()) return false;
+        out.position = hit["point"];
+    }
+    out.collider_id = (uint64_t)(int64_t)hit["collider_id"];
+    out.normal = hit["normal"];
+    return true;
+}
+
+void ProjectileServer::advance(double delta) {
+    if (paused || delta <= 0.0) return;
+    if (handles.empty()) {
+        // projectiles removed since the last pass may still be drawn
+        publish_visuals();
+        return;
+    }
+
+    PhysicsDirectSpaceState3D *space = nullptr;
+    Viewport *vp = is_inside_tree() ? get_viewport() : nullptr;
+    Ref<World3D> world = vp ? vp->find_world_3d() : Ref<World3D>();
+    if (world.is_valid()) space = world->get_direct_space_state();
+    if (space && !ray_query.is_valid()) {
+        ray_query.instantiate();
+        shape_query.instantiate();
+        sphere.instantiate();
+        shape_query->set_shape(sphere);
+        last_excluded = RID();
+    }
+
+    pending_impacts.clear();
+    pending_expired.clear();
+    const real_t dt = (real_t)delta;
+    size_t i = 0;
+    while (i < handles.size()) {
+        // semi-implicit Euler
+        velocities[i] += gravities[i] * dt;
+        const Vector3 motion = velocities[i] * dt;
+
+        PendingImpact impact;
+        if (space && sweep(space, i, motion, impact)) {
+            impact.handle = handles[i];
+            impact.caster_id = caster_ids[i];
+            impact.spell = impact_spells[i];
+            impact.meta = metadata[i];
+            pending_impacts.push_back(impact);
+            remove_at(i);
+            continue;
+        }
+
+        positions[i] += motion;
+        remaining[i] -= delta;
+        if (remaining[i] <= 0.0) {
+            pending_expired.push_back(handles[i]);
+            remove_at(i);
+            continue;
+        }
+        ++i;
+    }
+
+    publish_visuals();
+    dispatch();
+}
+
+void ProjectileServer::publish_visuals() {
+    if (published_meshes.empty() && meshes.empty()) return;
+    MultiMeshBatcher *batcher = MultiMeshBatcher::get_singleton();
+    if (!batcher) return;
+
+    // group by mesh; swarms usually share one or two meshes, so a linear lookup is enough
+    std::vector<Ref<Mesh>> used;
+    std::vector<std::vector<Transform3D>> transforms;
+    for (size_t i = 0; i < handles.size(); ++i) {
+        if (!meshes[i].is_valid()) continue;
+        size_t slot = 0;
+        while (slot < used.size() && used[slot] != meshes[i]) ++slot;
+        if (slot == used.size()) {
+            used.push_back(meshes[i]);
+            transforms.emplace_back();
+        }
+        Transform3D t(Basis(), positions[i]);
+        const Vector3 &v = velocities[i];
+        // face along the velocity (-Z forward); skip when moving (nearly) vertically or not at all
+        if (v.length_squared() > 1e-6f && Math::abs(v.normalized().y) < 0.999f) t.basis = Basis::looking_at(v);
+        transforms[slot].push_back(t);
+    }
+    for (size_t s = 0; s < used.size(); ++s) batcher->set_transforms(used[s], transforms[s]);
+    for (const Ref<Mesh> &m : published_meshes) {
+        bool still_used = false;
+        for (const Ref<Mesh> &u : used) still_used = still_used || u == m;
+        if (!still_used) batcher->set_transforms(m, std::vector<Transform3D>());
+    }
+    published_meshes.swap(used);
+}
+
+void ProjectileServer::dispatch() {
+    for (int64_t handle : pending_expired) emit_signal("projectile_expired", handle);
+    if (pending_impacts.empty()) return;
+
+    // handlers may spawn or remove projectiles, so work from a local list
+    std::vector<PendingImpact> impacts;
+    impacts.swap(pending_impacts);
+    DamageBatchScope batch;
+    for (const PendingImpact &impact : impacts) {
+        Object *collider = ObjectDB::get_instance(impact.collider_id);
+        emit_signal("projectile_hit", impact.handle, collider, impact.position, impact.normal);
+        if (!impact.spell.is_valid()) continue;
+
+        Ref<SpellContext> ctx;
+        ctx.instantiate();
+        Node *caster = Object::cast_to<Node>(ObjectDB::get_instance(impact.caster_id));
+        if (caster) ctx->set_caster(caster);
+        Array targets;
+        if (collider) targets.append(collider);
+        ctx->set_targets(targets);
+        Dictionary results;
+        results["chosen_position"] = impact.position;
+        results["impact_position"] = impact.position;
+        results["impact_normal"] = impact.normal;
+        results["projectile_metadata"] = impact.meta;
+        ctx->set_results(results);
+
+        SpellEngine *engine = get_impact_engine();
+        if (!engine) {
+            if (!default_impact_engine) default_impact_engine = memnew(SpellEngine);
+            engine = default_impact_engine;
+        }
+        SPELL_TRACE(SpellLog::CHANNEL_SUMMON, String("ProjectileServer: impact of projectile ") + String::num_int64(impact.handle) + String(" at ") + Variant(impact.position).operator String());
+        engine->execute_spell(impact.spell, ctx);
+    }
+}
+
+void ProjectileServer::set_paused(bool p_paused) {
+    paused = p_paused;
+}
+
+bool ProjectileServer::is_paused() const {
+    return paused;
+}
+
+void ProjectileServer::set_impact_engine(SpellEngine *engine) {
+    impact_engine_id = engine ? engine->get_instance_id() : 0;
+}
+
+SpellEngine *ProjectileServer::get_impact_engine() const {
+    if (impact_engine_id == 0) return nullptr;
+    return Object::cast_to<SpellEngine>(ObjectDB::get_instance(impact_engine_id));
+}
+
+void ProjectileServer::_bind_methods() {
+    ClassDB::bind_static_method("ProjectileServer", D_METHOD("get_singleton"), &ProjectileServer::get_singleton);
+    ClassDB::bind_method(D_METHOD("spawn", "origin", "velocity", "lifetime", "radius", "gravity", "collision_mask", "caster", "impact_spell", "metadata", "mesh"), &ProjectileServer::spawn, DEFVAL(Vector3()), DEFVAL(0xFFFFFFFF), DEFVAL(Variant()), DEFVAL(Ref<Spell>()), DEFVAL(Dictionary()), DEFVAL(Ref<Mesh>()));
+    ClassDB::bind_method(D_METHOD("remove", "handle"), &ProjectileServer::remove);
+    ClassDB::bind_method(D_METHOD("clear"), &ProjectileServer::clear);
+    ClassDB::bind_method(D_METHOD("get_count"), &ProjectileServer::get_count);
+    ClassDB::bind_method(D_METHOD("has_projectile", "handle"), &ProjectileServer::has_projectile);
+    ClassDB::bind_method(D_METHOD("get_position", "handle"), &ProjectileServer::get_position);
+    ClassDB::bind_method(D_METHOD("get_velocity", "handle"), &ProjectileServer::get_velocity);
+    ClassDB::bind_method(D_METHOD("advance", "delta"), &ProjectileServer::advance);
+    ClassDB::bind_method(D_METHOD("set_paused", "paused"), &ProjectileServer::set_paused);
+    ClassDB::bind_method(D_METHOD("is_paused"), &ProjectileServer::is_paused);
+    ClassDB::bind_method(D_METHOD("set_impact_engine", "engine"), &ProjectileServer::set_impact_engine);
+    ClassDB::bind_method(D_METHOD("get_impact_engine"), &ProjectileServer::get_impact_engine);
+
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "paused"), "set_paused", "is_paused");
+
+    ADD_SIGNAL(MethodInfo("projectile_hit", PropertyInfo(Variant::INT, "handle"), PropertyInfo(Variant::OBJECT, "collider"), PropertyInfo(Variant::VECTOR3, "position"), PropertyInfo(Variant::VECTOR3, "normal")));
+    ADD_SIGNAL(MethodInfo("projectile_expired", PropertyInfo(Variant::INT, "handle")));
+}
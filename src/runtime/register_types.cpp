@@ -6,7 +6,10 @@
 #include "spellengine/spell_context.hpp"
 #include "spellengine/spell_template.hpp"
 #include "spellengine/spell.hpp"
+#include "spellengine/compiled_spell.hpp"
 #include "spellengine/spell_engine.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/spell_stats.hpp"
 #include "spellengine/aspect_registry.hpp"
 #include "spellengine/editor/aspect_registry_plugin.hpp"
 #include "spellengine/spell_component_registry.hpp"
@@ -18,8 +21,17 @@
 #include "spellengine/knockback_executor.hpp"
 #include "spellengine/summon_executor.hpp"
 #include "spellengine/force_executor.hpp"
+#include "spellengine/noop_executor.hpp"
+#include "spellengine/projectile_executor.hpp"
 #include "spellengine/status_effect.hpp"
+#include "spellengine/status_effect_server.hpp"
 #include "spellengine/spell_caster.hpp"
+#include "spellengine/spell_target.hpp"
+#include "spellengine/scene_pool.hpp"
+#include "spellengine/scene_cache.hpp"
+#include "spellengine/summon_spawn_queue.hpp"
+#include "spellengine/projectile_server.hpp"
+#include "spellengine/multimesh_batcher.hpp"
 #include "spellengine/synergy_registry.hpp"
 #include "spellengine/synergy.hpp"
 #include "spellengine/control_gizmo.hpp"
@@ -52,15 +64,26 @@ void initialize_gdextension_types(ModuleInitializationLevel p_level)
     GDREGISTER_CLASS(SpellContext)
     GDREGISTER_CLASS(SpellTemplate)
     GDREGISTER_CLASS(Spell)
+    GDREGISTER_CLASS(CompiledSpell)
     GDREGISTER_CLASS(SpellEngine)
+    GDREGISTER_ABSTRACT_CLASS(SpellLog)
     GDREGISTER_ABSTRACT_CLASS(IExecutor)
     GDREGISTER_CLASS(DamageExecutor)
     GDREGISTER_CLASS(DotExecutor)
     GDREGISTER_CLASS(KnockbackExecutor)
     GDREGISTER_CLASS(SummonExecutor)
     GDREGISTER_CLASS(ForceExecutor)
+    GDREGISTER_CLASS(NoopExecutor)
+    GDREGISTER_CLASS(ProjectileExecutor)
     GDREGISTER_CLASS(StatusEffect)
+    GDREGISTER_CLASS(StatusEffectServer)
     GDREGISTER_CLASS(SpellCaster)
+    GDREGISTER_CLASS(SpellTarget)
+    GDREGISTER_CLASS(ScenePool)
+    GDREGISTER_CLASS(SceneCache)
+    GDREGISTER_CLASS(SummonSpawnQueue)
+    GDREGISTER_CLASS(ProjectileServer)
+    GDREGISTER_CLASS(MultiMeshBatcher)
     GDREGISTER_CLASS(ControlGizmo)
     GDREGISTER_CLASS(ControlManager)
     GDREGISTER_CLASS(ControlOrchestrator)
@@ -108,12 +131,17 @@ void initialize_gdextension_types(ModuleInitializationLevel p_level)
     // REGISTER_EXECUTOR_FACTORY(...) in their cpp files. This removes the need
     // to hardcode executor ids or instances here.
     ExecutorRegistry::register_all_factories();
+
+    SpellStats::register_monitors();
 }
 
 void uninitialize_gdextension_types(ModuleInitializationLevel p_level) {
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
     }
+    SpellStats::unregister_monitors();
+    ScenePool::shutdown();
+    SceneCache::shutdown();
 }
 
 extern "C"
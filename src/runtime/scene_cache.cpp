@@ -0,0 +1,131 @@
+#include "spellengine/scene_cache.hpp"
+#include "spellengine/spell_component.hpp"
+#include "spellengine/spell_log.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+
+using namespace godot;
+
+SceneCache *SceneCache::singleton = nullptr;
+
+SceneCache *SceneCache::get_singleton() {
+    if (!singleton) singleton = memnew(SceneCache);
+    return singleton;
+}
+
+void SceneCache::shutdown() {
+    if (!singleton) return;
+    singleton->clear();
+    memdelete(singleton);
+    singleton = nullptr;
+}
+
+void SceneCache::preload(const String &path) {
+    if (path.is_empty()) return;
+    Entry &e = entries[path];
+    if (e.scene.is_valid() || e.pending || e.failed) return;
+    ResourceLoader *rl = ResourceLoader::get_singleton();
+    if (!rl) return;
+    if (rl->load_threaded_request(path, "PackedScene") == OK) {
+        e.pending = true;
+    } else {
+        e.failed = true;
+        SPELL_WARN(SpellLog::CHANNEL_SUMMON, String("SceneCache: could not request background load of ") + path);
+    }
+}
+
+void SceneCache::preload_component(const Ref<SpellComponent> &component) {
+    if (!component.is_valid()) return;
+    Dictionary bp = component->get_base_params();
+    if (!bp.has("scene_path") || bp["scene_path"].get_type() != Variant::STRING) return;
+    preload(bp["scene_path"]);
+}
+
+void SceneCache::collect(const String &path, Entry &e, bool block) {
+    ResourceLoader *rl = ResourceLoader::get_singleton();
+    if (!rl) return;
+    if (e.pending) {
+        ResourceLoader::ThreadLoadStatus status = rl->load_threaded_get_status(path);
+        if (status == ResourceLoader::THREAD_LOAD_IN_PROGRESS && !block) return;
+        e.pending = false;
+        if (status == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE || status == ResourceLoader::THREAD_LOAD_FAILED) {
+            e.failed = true;
+            return;
+        }
+        // load_threaded_get waits for an in-progress load
+        Ref<Resource> r = rl->load_threaded_get(path);
+        e.scene = Ref<PackedScene>(Object::cast_to<PackedScene>(r.ptr()));
+    } else if (block) {
+        Ref<Resource> r = rl->load(path);
+        e.scene = Ref<PackedScene>(Object::cast_to<PackedScene>(r.ptr()));
+    } else {
+        return;
+    }
+    if (!e.scene.is_valid()) e.failed = true;
+}
+
+Ref<PackedScene> SceneCache::get_scene(const String &path) {
+    if (path.is_empty()) return Ref<PackedScene>();
+    Entry &e = entries[path];
+    if (e.scene.is_valid()) {
+        hits += 1;
+        return e.scene;
+    }
+    misses += 1;
+    if (!e.failed) collect(path, e, true);
+    return e.scene;
+}
+
+bool SceneCache::is_cached(const String &path) {
+    auto it = entries.find(path);
+    if (it == entries.end()) return false;
+    if (it->second.pending) collect(path, it->second, false);
+    return it->second.scene.is_valid();
+}
+
+int SceneCache::poll() {
+    int collected = 0;
+    for (auto &kv : entries) {
+        if (!kv.second.pending) continue;
+        collect(kv.first, kv.second, false);
+        if (!kv.second.pending) collected += 1;
+    }
+    return collected;
+}
+
+Dictionary SceneCache::get_stats() const {
+    int64_t cached = 0;
+    int64_t pending = 0;
+    for (const auto &kv : entries) {
+        if (kv.second.scene.is_valid()) cached += 1;
+        if (kv.second.pending) pending += 1;
+    }
+    Dictionary d;
+    d["cached"] = cached;
+    d["pending"] = pending;
+    d["hits"] = hits;
+    d["misses"] = misses;
+    return d;
+}
+
+void SceneCache::clear() {
+    // finish in-flight requests so the loader does not keep them around
+    for (auto &kv : entries) {
+        if (kv.second.pending) collect(kv.first, kv.second, true);
+    }
+    entries.clear();
+    hits = 0;
+    misses = 0;
+}
+
+void SceneCache::_bind_methods() {
+    ClassDB::bind_static_method("SceneCache", D_METHOD("get_singleton"), &SceneCache::get_singleton);
+    ClassDB::bind_method(D_METHOD("preload", "path"), &SceneCache::preload);
+    ClassDB::bind_method(D_METHOD("preload_component", "component"), &SceneCache::preload_component);
+    ClassDB::bind_method(D_METHOD("get_scene", "path"), &SceneCache::get_scene);
+    ClassDB::bind_method(D_METHOD("is_cached", "path"), &SceneCache::is_cached);
+    ClassDB::bind_method(D_METHOD("poll"), &SceneCache::poll);
+    ClassDB::bind_method(D_METHOD("get_stats"), &SceneCache::get_stats);
+    ClassDB::bind_method(D_METHOD("clear"), &SceneCache::clear);
+}
@@ -0,0 +1,165 @@
+#include "spellengine/scene_pool.hpp"
+#include "spellengine/inert_registry.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/rigid_body3d.hpp>
+#include <algorithm>
+
+using namespace godot;
+
+ScenePool *ScenePool::singleton = nullptr;
+
+static const char *META_POOL_KEY = "spell_pool_key";
+
+ScenePool *ScenePool::get_singleton() {
+    if (!singleton) singleton = memnew(ScenePool);
+    return singleton;
+}
+
+void ScenePool::shutdown() {
+    if (!singleton) return;
+    singleton->clear();
+    memdelete(singleton);
+    singleton = nullptr;
+}
+
+ScenePool::Pool &ScenePool::pool_for(const Ref<PackedScene> &scene) {
+    Pool &pool = pools[scene->get_instance_id()];
+    if (!pool.scene.is_valid()) pool.scene = scene;
+    return pool;
+}
+
+Node *ScenePool::instantiate_into(Pool &pool) {
+    Node *inst = pool.scene->instantiate();
+    if (!inst) return nullptr;
+    inst->set_meta(META_POOL_KEY, (int64_t)pool.scene->get_instance_id());
+    pool.created += 1;
+    return inst;
+}
+
+void ScenePool::configure(const Ref<PackedScene> &scene, int warm_size, int cap) {
+    if (!scene.is_valid()) return;
+    Pool &pool = pool_for(scene);
+    pool.cap = cap < 0 ? 0 : cap;
+    const size_t warm = (size_t)std::min(warm_size, pool.cap);
+    while (pool.free_ids.size() < warm) {
+        Node *inst = instantiate_into(pool);
+        if (!inst) break;
+        pool.free_ids.push_back(inst->get_instance_id());
+    }
+}
+
+bool ScenePool::has_pool(const Ref<PackedScene> &scene) const {
+    return scene.is_valid() && pools.find(scene->get_instance_id()) != pools.end();
+}
+
+void ScenePool::reset_instance(Node *inst) {
+    // A released instance may still be waiting for its deferred detach
+    Node *parent = inst->get_parent();
+    if (parent) parent->remove_child(inst);
+
+    InertRegistry::activate(inst);
+    inst->set_physics_process(true);
+
+    Node3D *n3 = Object::cast_to<Node3D>(inst);
+    if (n3) n3->set_transform(Transform3D());
+    // freeze is left as authored (InertRegistry::activate restored it if the instance was parked)
+    RigidBody3D *rb = Object::cast_to<RigidBody3D>(inst);
+    if (rb) {
+        rb->set_linear_velocity(Vector3());
+        rb->set_angular_velocity(Vector3());
+    }
+    if (inst->has_method("on_pool_acquire")) inst->call("on_pool_acquire");
+}
+
+Node *ScenePool::acquire(const Ref<PackedScene> &scene) {
+    if (!scene.is_valid()) return nullptr;
+    Pool &pool = pool_for(scene);
+    while (!pool.free_ids.empty()) {
+        const uint64_t id = pool.free_ids.back();
+        pool.free_ids.pop_back();
+        Node *inst = Object::cast_to<Node>(ObjectDB::get_instance(id));
+        if (!inst || inst->is_queued_for_deletion()) continue;
+        reset_instance(inst);
+        pool.reused += 1;
+        return inst;
+    }
+    return instantiate_into(pool);
+}
+
+bool ScenePool::release(Node *inst) {
+    if (!inst || !inst->has_meta(META_POOL_KEY)) return false;
+    auto it = pools.find((uint64_t)(int64_t)inst->get_meta(META_POOL_KEY));
+    if (it == pools.end()) return false;
+    Pool &pool = it->second;
+
+    const uint64_t id = inst->get_instance_id();
+    if (std::find(pool.free_ids.begin(), pool.free_ids.end(), id) != pool.free_ids.end()) return true;
+    if ((int)pool.free_ids.size() >= pool.cap) {
+        inst->queue_free();
+        return true;
+    }
+    pool.free_ids.push_back(id);
+    // detach deferred: release() is often called from the instance's own physics callbacks
+    if (inst->get_parent()) call_deferred("_detach", (int64_t)id);
+    return true;
+}
+
+void ScenePool::_detach(int64_t instance_id) {
+    // skipped if the instance was acquired (and detached) again before the deferred call ran
+    Node *inst = Object::cast_to<Node>(ObjectDB::get_instance((uint64_t)instance_id));
+    if (!inst || !inst->has_meta(META_POOL_KEY)) return;
+    auto it = pools.find((uint64_t)(int64_t)inst->get_meta(META_POOL_KEY));
+    if (it == pools.end()) return;
+    const std::vector<uint64_t> &ids = it->second.free_ids;
+    if (std::find(ids.begin(), ids.end(), (uint64_t)instance_id) == ids.end()) return;
+    Node *parent = inst->get_parent();
+    if (parent) parent->remove_child(inst);
+}
+
+int ScenePool::get_free_count(const Ref<PackedScene> &scene) const {
+    if (!scene.is_valid()) return 0;
+    auto it = pools.find(scene->get_instance_id());
+    return it == pools.end() ? 0 : (int)it->second.free_ids.size();
+}
+
+Dictionary ScenePool::get_stats() const {
+    Dictionary out;
+    for (const auto &kv : pools) {
+        const Pool &pool = kv.second;
+        Dictionary d;
+        d["free"] = (int64_t)pool.free_ids.size();
+        d["cap"] = pool.cap;
+        d["created"] = pool.created;
+        d["reused"] = pool.reused;
+        String key = pool.scene->get_path();
+        if (key.is_empty()) key = String::num_uint64(kv.first);
+        out[key] = d;
+    }
+    return out;
+}
+
+void ScenePool::clear() {
+    for (auto &kv : pools) {
+        for (uint64_t id : kv.second.free_ids) {
+            Node *inst = Object::cast_to<Node>(ObjectDB::get_instance(id));
+            if (!inst) continue;
+            if (inst->is_inside_tree()) inst->queue_free();
+            else memdelete(inst);
+        }
+    }
+    pools.clear();
+}
+
+void ScenePool::_bind_methods() {
+    ClassDB::bind_static_method("ScenePool", D_METHOD("get_singleton"), &ScenePool::get_singleton);
+    ClassDB::bind_method(D_METHOD("configure", "scene", "warm_size", "cap"), &ScenePool::configure);
+    ClassDB::bind_method(D_METHOD("has_pool", "scene"), &ScenePool::has_pool);
+    ClassDB::bind_method(D_METHOD("acquire", "scene"), &ScenePool::acquire);
+    ClassDB::bind_method(D_METHOD("release", "instance"), &ScenePool::release);
+    ClassDB::bind_method(D_METHOD("get_free_count", "scene"), &ScenePool::get_free_count);
+    ClassDB::bind_method(D_METHOD("get_stats"), &ScenePool::get_stats);
+    ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+    ClassDB::bind_method(D_METHOD("_detach", "instance_id"), &ScenePool::_detach);
+}
@@ -7,6 +7,7 @@ using namespace godot;
 
 void Spell::set_components(const TypedArray<Ref<SpellComponent>> &p_components) {
     components = p_components;
+    compiled_plan.unref();
 }
 
 TypedArray<Ref<SpellComponent>> Spell::get_components() const {
@@ -21,6 +22,14 @@ String Spell::get_source_template() const {
     return source_template;
 }
 
+Ref<CompiledSpell> Spell::get_compiled_plan() const {
+    return compiled_plan;
+}
+
+void Spell::set_compiled_plan(const Ref<CompiledSpell> &p_plan) {
+    compiled_plan = p_plan;
+}
+
 void Spell::execute(Ref<SpellContext> ctx) {
     if (!ctx.is_valid()) {
         UtilityFunctions::print("Spell::execute called with invalid context");
@@ -1,33 +1,62 @@
 #include "spellengine/spell_caster.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
+#include "spellengine/intern_table.hpp"
+#include <cmath>
 // Note: aspect defaults are applied during spell composition in SpellEngine, not here.
 
 using namespace godot;
 
+void SpellCaster::ensure_mana_slot(int aspect_id) {
+    if (aspect_id >= (int)mana.size()) {
+        mana.resize(aspect_id + 1, 0.0);
+        mana_present.resize(aspect_id + 1, 0);
+    }
+    mana_present[aspect_id] = 1;
+}
+
+int SpellCaster::author_aspect(const String &aspect) {
+    int id = InternTable::aspects().intern(aspect);
+    if (id >= (int)aspect_spellings.size()) aspect_spellings.resize(id + 1);
+    aspect_spellings[id] = aspect;
+    return id;
+}
+
+const String &SpellCaster::get_aspect_spelling(int aspect_id) const {
+    if (aspect_id < (int)aspect_spellings.size() && !aspect_spellings[aspect_id].is_empty()) return aspect_spellings[aspect_id];
+    return InternTable::aspects().get_name(aspect_id);
+}
+
 double SpellCaster::get_mana(const String &aspect) const {
-    if (aspect_mana.has(aspect)) return (double)aspect_mana[aspect];
-    return 0.0;
+    int id = InternTable::aspects().find(aspect);
+    if (id < 0 || id >= (int)mana.size() || !mana_present[id]) return 0.0;
+    return mana[id];
 }
 
 void SpellCaster::set_mana(const String &aspect, double amount) {
-    aspect_mana[aspect] = amount;
+    int id = author_aspect(aspect);
+    ensure_mana_slot(id);
+    mana[id] = amount;
 }
 
 void SpellCaster::add_mana(const String &aspect, double amount) {
-    double cur = get_mana(aspect);
-    aspect_mana[aspect] = cur + amount;
+    int id = author_aspect(aspect);
+    ensure_mana_slot(id);
+    mana[id] += amount;
 }
 
 bool SpellCaster::can_deduct(const String &aspect, double amount) const {
-    double cur = get_mana(aspect);
-    return cur >= amount - 1e-9;
+    return can_deduct_by_id(InternTable::aspects().find(aspect), amount);
 }
 
 bool SpellCaster::deduct_mana(const String &aspect, double amount) {
-    if (!can_deduct(aspect, amount)) return false;
-    double cur = get_mana(aspect);
-    aspect_mana[aspect] = cur - amount;
+    return deduct_mana_by_id(InternTable::aspects().intern(aspect), amount);
+}
+
+bool SpellCaster::deduct_mana_by_id(int aspect_id, double amount) {
+    if (aspect_id < 0 || !can_deduct_by_id(aspect_id, amount)) return false;
+    ensure_mana_slot(aspect_id);
+    mana[aspect_id] -= amount;
     return true;
 }
 
@@ -40,11 +69,22 @@ void SpellCaster::set_assigned_aspects(const Array &a) {
 }
 
 Dictionary SpellCaster::get_aspect_mana() const {
-    return aspect_mana;
+    Dictionary out;
+    for (size_t i = 0; i < mana.size(); ++i) {
+        if (mana_present[i]) out[get_aspect_spelling((int)i)] = mana[i];
+    }
+    return out;
 }
 
 void SpellCaster::set_aspect_mana(const Dictionary &m) {
-    aspect_mana = m;
+    mana.clear();
+    mana_present.clear();
+    Array keys = m.keys();
+    for (int i = 0; i < keys.size(); ++i) {
+        Variant v = m[keys[i]];
+        if (v.get_type() != Variant::INT && v.get_type() != Variant::FLOAT) continue;
+        set_mana(keys[i], (double)v);
+    }
 }
 
 int SpellCaster::get_scaler_merge_mode() const {
@@ -56,32 +96,54 @@ void SpellCaster::set_scaler_merge_mode(int mode) {
 }
 
 Dictionary SpellCaster::get_aspect_scalers() const {
-    return aspect_scalers;
+    Dictionary out;
+    const InternTable &params = InternTable::params();
+    for (size_t a = 0; a < scalers.size(); ++a) {
+        const std::vector<double> &row = scalers[a];
+        Dictionary dict;
+        for (size_t p = 0; p < row.size(); ++p) {
+            if (std::isnan(row[p])) continue;
+            dict[params.get_name((int)p)] = row[p];
+        }
+        if (dict.size() > 0) out[get_aspect_spelling((int)a)] = dict;
+    }
+    return out;
 }
 
 void SpellCaster::set_aspect_scalers(const Dictionary &s) {
-    aspect_scalers = s;
+    // Only numeric scaler values are imported; other entries were already ignored by get_scaler.
+    scalers.clear();
+    Array aspect_keys = s.keys();
+    for (int i = 0; i < aspect_keys.size(); ++i) {
+        Variant v = s[aspect_keys[i]];
+        if (v.get_type() != Variant::DICTIONARY) continue;
+        Dictionary dict = v;
+        Array param_keys = dict.keys();
+        for (int k = 0; k < param_keys.size(); ++k) {
+            Variant sv = dict[param_keys[k]];
+            if (sv.get_type() != Variant::INT && sv.get_type() != Variant::FLOAT) continue;
+            set_scaler(aspect_keys[i], param_keys[k], (double)sv);
+        }
+    }
+    scaler_version += 1;
 }
 
 double SpellCaster::get_scaler(const String &aspect, const String &key) const {
-    if (!aspect_scalers.has(aspect)) return 1.0;
-    Variant v = aspect_scalers[aspect];
-    if (v.get_type() != Variant::DICTIONARY) return 1.0;
-    Dictionary dict = v;
-    if (!dict.has(key)) return 1.0;
-    Variant sv = dict[key];
-    if (sv.get_type() == Variant::INT || sv.get_type() == Variant::FLOAT) return (double)sv;
-    return 1.0;
+    return get_scaler_by_id(InternTable::aspects().find(aspect), InternTable::params().find(key));
 }
 
 void SpellCaster::set_scaler(const String &aspect, const String &key, double value) {
-    Dictionary dict;
-    if (aspect_scalers.has(aspect)) {
-        Variant v = aspect_scalers[aspect];
-        if (v.get_type() == Variant::DICTIONARY) dict = v;
-    }
-    dict[key] = value;
-    aspect_scalers[aspect] = dict;
+    int aid = author_aspect(aspect);
+    int pid = InternTable::params().intern(key);
+    if (aid >= (int)scalers.size()) scalers.resize(aid + 1);
+    std::vector<double> &row = scalers[aid];
+    if (pid >= (int)row.size()) row.resize(pid + 1, std::nan(""));
+    row[pid] = value;
+    scaler_version += 1;
+}
+
+uint64_t SpellCaster::get_scaler_version() const {
+    return scaler_version;
 }
 
 void SpellCaster::_bind_methods() {
@@ -98,6 +160,7 @@ void SpellCaster::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_aspect_scalers", "scalers"), &SpellCaster::set_aspect_scalers);
     ClassDB::bind_method(D_METHOD("get_scaler", "aspect", "key"), &SpellCaster::get_scaler);
     ClassDB::bind_method(D_METHOD("set_scaler", "aspect", "key", "value"), &SpellCaster::set_scaler);
+    ClassDB::bind_method(D_METHOD("get_scaler_version"), &SpellCaster::get_scaler_version);
 
     ClassDB::bind_method(D_METHOD("get_scaler_merge_mode"), &SpellCaster::get_scaler_merge_mode);
     ClassDB::bind_method(D_METHOD("set_scaler_merge_mode", "mode"), &SpellCaster::set_scaler_merge_mode);
@@ -5,12 +5,25 @@
 #include "spellengine/executor_registry.hpp"
 #include "spellengine/executor_base.hpp"
 #include "spellengine/spell_caster.hpp"
+#include "spellengine/intern_table.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/damage_accumulator.hpp"
+#include "spellengine/target_capabilities.hpp"
+#include "spellengine/inert_registry.hpp"
+#include "spellengine/spell_stats.hpp"
+#include "spellengine/spell_trace.hpp"
 #include "spellengine/synergy_registry.hpp"
+#include "spellengine/summon_spawn_queue.hpp"
 #include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include "spellengine/control_orchestrator.hpp"
 #include "spellengine/aspect.hpp"
+#include "spellengine/compiled_spell.hpp"
+#include "spellengine/spell_template.hpp"
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 using namespace godot;
 
@@ -27,6 +40,17 @@ static double merge_scalers(double existing, double incoming, int mode) {
     }
 }
 
+// Helper: casting aspects come from ctx.params.aspects, falling back to the caster's assigned aspects
+static Array derive_casting_aspects(const Dictionary &ctx_params, SpellCaster *caster) {
+    Array casting_aspects;
+    if (ctx_params.has("aspects")) {
+        Variant v = ctx_params["aspects"];
+        if (v.get_type() == Variant::ARRAY) casting_aspects = v;
+    }
+    if (casting_aspects.size() == 0 && caster) casting_aspects = caster->get_assigned_aspects();
+    return casting_aspects;
+}
+
 Ref<Spell> SpellEngine::build_spell_from_aspects(const TypedArray<Ref<Aspect>> &aspects) {
     Ref<Spell> spell = memnew(Spell);
 
@@ -47,6 +71,7 @@ Ref<Spell> SpellEngine::build_spell_from_aspects(const TypedArray<Ref<Aspect>> &
 
 void SpellEngine::set_default_merge_mode(const String &key, int mode) {
     default_merge_modes[key] = mode;
+    config_revision += 1;
 }
 
 int SpellEngine::get_default_merge_mode(const String &key) const {
@@ -56,6 +81,7 @@ int SpellEngine::get_default_merge_mode(const String &key) const {
 
 void SpellEngine::set_merge_mode_mana_multiplier(int mode, double multiplier) {
     merge_mode_multipliers[mode] = multiplier;
+    config_revision += 1;
 }
 
 double SpellEngine::get_merge_mode_mana_multiplier(int mode) const {
@@ -63,268 +89,393 @@ double SpellEngine::get_merge_mode_mana_multiplier(int mode) const {
     return 1.0;
 }
 
+Ref<CompiledSpell> SpellEngine::compile_spell(Ref<Spell> spell) {
+    if (!spell.is_valid()) return Ref<CompiledSpell>();
+    TypedArray<Ref<SpellComponent>> comps = spell->get_components();
+    Ref<CompiledSpell> plan = spell->get_compiled_plan();
+    if (plan.is_valid() && plan->is_current_for(comps)) return plan;
+
+    plan = Ref<CompiledSpell>(memnew(CompiledSpell));
+    plan->compile(comps);
+    spell->set_compiled_plan(plan);
+    return plan;
+}
+
+Ref<CompiledSpell> SpellEngine::compile_template(Ref<SpellTemplate> tmpl) {
+    if (!tmpl.is_valid()) return Ref<CompiledSpell>();
+    Ref<CompiledSpell> plan = Ref<CompiledSpell>(memnew(CompiledSpell));
+    plan->compile(tmpl->get_components());
+    return plan;
+}
+
 void SpellEngine::execute_spell(Ref<Spell> spell, Ref<SpellContext> ctx) {
     if (!spell.is_valid()) {
-        UtilityFunctions::print("SpellEngine: invalid spell passed to execute_spell");
+        SPELL_ERROR(SpellLog::CHANNEL_ENGINE, "SpellEngine: invalid spell passed to execute_spell");
         return;
     }
 
-    Array casting_aspects;
-    Dictionary ctx_params = ctx->get_params();
+    execute_compiled(compile_spell(spell), ctx);
+}
+
+void SpellEngine::execute_compiled(Ref<CompiledSpell> plan, Ref<SpellContext> ctx) {
+    _execute_plan(plan, ctx);
+}
+
+int SpellEngine::_execute_plan(const Ref<CompiledSpell> &plan, const Ref<SpellContext> &ctx) {
+    if (!plan.is_valid() || !ctx.is_valid()) {
+        SPELL_ERROR(SpellLog::CHANNEL_ENGINE, "SpellEngine: invalid plan or context passed to execute_compiled");
+        return CAST_INVALID_ARGS;
+    }
 
     // generate a unique cast id for this spell execution (propagated to executors and synergies)
     cast_counter += 1;
-    String cast_id = "spell_cast_" + String::num(cast_counter);
-    if (ctx_params.has("aspects")) {
-        Variant v = ctx_params["aspects"];
-        if (v.get_type() == Variant::ARRAY) casting_aspects = v;
-    }
+    const uint64_t cast_number = cast_counter;
+    SPELL_TRACE_SPAN("cast", cast_number, String());
+    SpellStats::count(SpellStats::casts);
+    return _execute_steps(plan, ctx, 0, cast_number);
+}
 
-    Node *caster_node = ctx->get_caster();
-    if (casting_aspects.size() == 0 && caster_node) {
-        SpellCaster *sc = Object::cast_to<SpellCaster>(caster_node);
-        if (sc) casting_aspects = sc->get_assigned_aspects();
-    }
+void SpellEngine::_resume_plan(const Ref<CompiledSpell> &plan, const Ref<SpellContext> &ctx, int64_t next_step, int64_t cast_number) {
+    if (!plan.is_valid() || !ctx.is_valid()) return;
+    _execute_steps(plan, ctx, (size_t)next_step, (uint64_t)cast_number);
+}
 
-    TypedArray<Ref<SpellComponent>> comps = spell->get_components();
-    for (int i = 0; i < comps.size(); ++i) {
-        Ref<SpellComponent> comp = comps[i];
-        if (!comp.is_valid()) continue;
+int SpellEngine::_execute_steps(const Ref<CompiledSpell> &plan, const Ref<SpellContext> &ctx, size_t first_step, uint64_t cast_number) {
+    bool had_failure = ctx->get_results().has("executor_failed");
+    // damage from every component and synergy of this cast reaches each target in one delivery
+    DamageBatchScope damage_batch;
 
-        SpellCaster *sc_for_resolve = nullptr;
-        if (caster_node) sc_for_resolve = Object::cast_to<SpellCaster>(caster_node);
+    Dictionary ctx_params = ctx->get_params();
+    String cast_id = "spell_cast_" + String::num(cast_number);
 
-    Dictionary resolved = resolve_component_params(comp, casting_aspects, sc_for_resolve, ctx_params);
+    Node *caster_node = ctx->get_caster();
+    SpellCaster *sc = nullptr;
+    if (caster_node) sc = Object::cast_to<SpellCaster>(caster_node);
+    Array casting_aspects = derive_casting_aspects(ctx_params, sc);
+    const int key_cast_id = ParamBlock::key("cast_id");
+
+    // Mana is checked and deducted by interned aspect id. The casting aspects are interned once
+    // per plan; cost keys outside them (components whose contributions name other aspects) fall
+    // back to a single intern each.
+    std::vector<String> casting_names;
+    std::vector<int> casting_ids;
+    for (int ai = 0; ai < casting_aspects.size(); ++ai) {
+        casting_names.push_back(casting_aspects[ai]);
+        casting_ids.push_back(InternTable::aspects().intern(casting_names.back()));
+    }
+    std::vector<std::pair<int, double>> step_costs;
+
+    const std::vector<CompiledSpell::Step> &steps = plan->get_steps();
+    for (size_t i = first_step; i < steps.size(); ++i) {
+        const CompiledSpell::Step &step = steps[i];
+        Ref<SpellComponent> comp = step.component;
+
+        // resolved is shared with the resolution cache; read it, never write to it
+        Dictionary resolved;
+        ParamBlock params;
+        {
+            SPELL_TRACE_SPAN("resolve", cast_number, step.executor_id);
+            const uint64_t resolve_start = SpellTrace::now_usec();
+            _resolve_shared(comp, casting_aspects, sc, ctx_params, resolved, &params);
+            SpellStats::resolve_latency.record(SpellTrace::now_usec() - resolve_start);
+        }
         if (verbose_composition) {
-            UtilityFunctions::print(String("[SpellEngine] Resolved component '") + comp->get_executor_id() + "':");
+            UtilityFunctions::print(String("[SpellEngine] Resolved component '") + step.executor_id + "':");
             if (resolved.has("resolved_params")) UtilityFunctions::print(String("  resolved_params: ") + String::num(resolved["resolved_params"].get_type()));
             if (resolved.has("cost_per_aspect")) UtilityFunctions::print(String("  cost_per_aspect: ") + String::num(resolved["cost_per_aspect"].get_type()));
         }
-        Dictionary resolved_params;
-        if (resolved.has("resolved_params")) resolved_params = resolved["resolved_params"];
-
-        Dictionary cost_per_aspect;
-        if (resolved.has("cost_per_aspect")) cost_per_aspect = resolved["cost_per_aspect"];
-
-        bool can_cast = true;
-        SpellCaster *sc = nullptr;
-        if (caster_node) sc = Object::cast_to<SpellCaster>(caster_node);
-
-        Array cost_keys = cost_per_aspect.keys();
-        for (int ci = 0; ci < cost_keys.size(); ++ci) {
-            String aspect = cost_keys[ci];
-            double need = (double)cost_per_aspect[aspect];
-            if (!sc) { can_cast = false; break; }
-            if (!sc->can_deduct(aspect, need)) { can_cast = false; break; }
-        }
+        {
+            SPELL_TRACE_SPAN("mana", cast_number, step.executor_id);
+            Dictionary cost_per_aspect;
+            if (resolved.has("cost_per_aspect")) cost_per_aspect = resolved["cost_per_aspect"];
+
+            bool can_cast = true;
+            step_costs.clear();
+            Array cost_keys = cost_per_aspect.keys();
+            for (int ci = 0; ci < cost_keys.size(); ++ci) {
+                String aspect = cost_keys[ci];
+                int aspect_id = -1;
+                for (size_t ai = 0; ai < casting_names.size(); ++ai) {
+                    if (casting_names[ai] == aspect) { aspect_id = casting_ids[ai]; break; }
+                }
+                if (aspect_id < 0) aspect_id = InternTable::aspects().intern(aspect);
+                step_costs.push_back({ aspect_id, (double)cost_per_aspect[aspect] });
+            }
+            for (size_t ci = 0; ci < step_costs.size(); ++ci) {
+                if (!sc) { can_cast = false; break; }
+                if (!sc->can_deduct_by_id(step_costs[ci].first, step_costs[ci].second)) { can_cast = false; break; }
+            }
 
-        if (!can_cast) {
-            UtilityFunctions::print(String("SpellEngine: caster lacks mana for component: ") + comp->get_executor_id());
-            return;
-        }
+            if (!can_cast) {
+                SPELL_WARN(SpellLog::CHANNEL_ENGINE, String("SpellEngine: caster lacks mana for component: ") + step.executor_id);
+                return CAST_INSUFFICIENT_MANA;
+            }
 
-        for (int ci = 0; ci < cost_keys.size(); ++ci) {
-            String aspect = cost_keys[ci];
-            double need = (double)cost_per_aspect[aspect];
-            sc->deduct_mana(aspect, need);
+            for (size_t ci = 0; ci < step_costs.size(); ++ci) {
+                sc->deduct_mana_by_id(step_costs[ci].first, step_costs[ci].second);
+            }
         }
 
-        ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
+        // ensure the resolved params carry the cast id so targets can group events
+        params.set(key_cast_id, cast_id);
         // Skip control-only components (those that begin with choose_ or select_)
         // They are handled earlier by ControlOrchestrator via resolve_controls and
         // should not be executed as normal executors during execute_spell.
-        String comp_exec_id = comp->get_executor_id();
-        if (comp_exec_id.begins_with("choose_") || comp_exec_id.begins_with("select_")) {
-            if (verbose_composition) UtilityFunctions::print(String("SpellEngine: skipping control-only component execution for: ") + comp_exec_id);
-        } else if (reg && reg->has_executor(comp->get_executor_id())) {
-            Ref<IExecutor> exec = reg->get_executor(comp->get_executor_id());
-            if (exec.is_valid()) {
-                // ensure the resolved params carry the cast id so targets can group events
-                Dictionary rp_with_cast = resolved_params;
-                rp_with_cast["cast_id"] = cast_id;
-                exec->execute(ctx, comp, rp_with_cast);
-            }
+        if (step.is_control) {
+            if (verbose_composition) UtilityFunctions::print(String("SpellEngine: skipping control-only component execution for: ") + step.executor_id);
+        } else if (step.executor.is_valid()) {
+            SPELL_TRACE_SPAN("execute", cast_number, step.executor_id);
+            const uint64_t execute_start = SpellTrace::now_usec();
+            step.executor->execute_block(ctx, comp, params);
+            SpellStats::execute_latency.record(SpellTrace::now_usec() - execute_start);
+            SpellStats::count(SpellStats::components_executed);
         } else {
-            UtilityFunctions::print(String("SpellEngine: no executor registered for: ") + comp->get_executor_id());
+            SPELL_WARN(SpellLog::CHANNEL_ENGINE, String("SpellEngine: no executor registered for: ") + step.executor_id);
         }
 
         if (resolved.has("aspects_used")) {
-            Array aspects_used = resolved["aspects_used"];
-            Array sorted = aspects_used.duplicate();
-            sorted.sort();
-            String skey = "";
-            for (int si = 0; si < sorted.size(); ++si) {
-                if (si) skey += "+";
-                skey += (String)sorted[si];
+            SPELL_TRACE_SPAN("synergies", cast_number, step.executor_id);
+            _run_component_synergies(ctx, comp, resolved, params, cast_number, sc);
+        }
+
+        // A time-sliced or async summon has only queued its instances. Later components read
+        // spawned_instances / targets (force_v1 wakes the inert bodies), so they wait for the spawns.
+        if (i + 1 < steps.size()) {
+            Dictionary spawn_groups = ctx->get_results().get("spawn_groups", Dictionary());
+            SummonSpawnQueue *queue = spawn_groups.is_empty() ? nullptr : SummonSpawnQueue::get_singleton();
+            if (queue) {
+                SPELL_DEBUG(SpellLog::CHANNEL_ENGINE, String("SpellEngine: deferring components after '") + step.executor_id + "' until queued summons spawn");
+                queue->call_when_spawned(ctx, callable_mp(this, &SpellEngine::_resume_plan).bind(plan, ctx, (int64_t)(i + 1), (int64_t)cast_number));
+                break;
+            }
+        }
+    }
+
+    if (!had_failure && ctx->get_results().has("executor_failed")) return CAST_EXECUTOR_FAILED;
+    return CAST_OK;
+}
+
+PackedInt32Array SpellEngine::execute_spells_batch(const Array &casts) {
+    PackedInt32Array statuses;
+    statuses.resize(casts.size());
+    DamageBatchScope damage_batch;
+
+    // Compile each distinct spell once for the whole batch; casts still run in
+    // submission order since casters may appear more than once and share mana.
+    std::unordered_map<const Spell *, Ref<CompiledSpell>> plans;
+    for (int i = 0; i < casts.size(); ++i) {
+        Variant entry = casts[i];
+        Ref<Spell> spell;
+        Ref<SpellContext> ctx;
+        if (entry.get_type() == Variant::DICTIONARY) {
+            Dictionary d = entry;
+            spell = d.get("spell", Variant());
+            ctx = d.get("context", Variant());
+        } else if (entry.get_type() == Variant::ARRAY) {
+            Array a = entry;
+            if (a.size() >= 2) {
+                spell = a[0];
+                ctx = a[1];
             }
-            // normalize for registry lookup
-            String skey_lower = skey.to_lower();
-            UtilityFunctions::print(String("[SpellEngine] execute_spell combined key: '") + skey + "' -> '" + skey_lower + "'");
-
-            SynergyRegistry *sreg = SynergyRegistry::get_singleton();
-            if (sreg && sreg->has_synergy(skey_lower)) {
-                Dictionary spec = sreg->get_synergy(skey_lower);
-                if (spec.has("callable")) {
-                    Variant cv = spec["callable"];
-                    if (cv.get_type() == Variant::CALLABLE) {
-                        Callable cb = cv;
+        }
+        statuses.set(i, _execute_batch_entry(spell, ctx, plans));
+    }
+    return statuses;
+}
+
+PackedInt32Array SpellEngine::execute_spells_batch_typed(const TypedArray<Spell> &spells, const TypedArray<SpellContext> &contexts) {
+    PackedInt32Array statuses;
+    int count = spells.size();
+    statuses.resize(count);
+    DamageBatchScope damage_batch;
+
+    std::unordered_map<const Spell *, Ref<CompiledSpell>> plans;
+    for (int i = 0; i < count; ++i) {
+        Ref<Spell> spell = spells[i];
+        Ref<SpellContext> ctx;
+        if (i < contexts.size()) ctx = contexts[i];
+        statuses.set(i, _execute_batch_entry(spell, ctx, plans));
+    }
+    return statuses;
+}
+
+int SpellEngine::_execute_batch_entry(const Ref<Spell> &spell, const Ref<SpellContext> &ctx, std::unordered_map<const Spell *, Ref<CompiledSpell>> &plans) {
+    if (!spell.is_valid() || !ctx.is_valid()) return CAST_INVALID_ARGS;
+    Ref<CompiledSpell> plan;
+    auto it = plans.find(spell.ptr());
+    if (it != plans.end()) {
+        plan = it->second;
+    } else {
+        plan = compile_spell(spell);
+        plans[spell.ptr()] = plan;
+    }
+    return _execute_plan(plan, ctx);
+}
+
+void SpellEngine::_run_component_synergies(Ref<SpellContext> ctx, Ref<SpellComponent> comp, const Dictionary &resolved, const ParamBlock &params_with_cast, uint64_t cast_number, SpellCaster *sc) {
+    ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
+    Array aspects_used = resolved["aspects_used"];
+
+    // indexed lookup by aspect bitmask; skey_lower receives the canonical combined key
+    SynergyRegistry *sreg = SynergyRegistry::get_singleton();
+    Dictionary spec;
+    String skey_lower;
+    if (sreg && sreg->find_synergy_for_aspects(aspects_used, spec, &skey_lower)) {
+        SpellStats::count(SpellStats::synergy_hits);
+        if (verbose_composition) UtilityFunctions::print(String("[SpellEngine] execute_spell matched synergy: '") + skey_lower + "'");
+        if (spec.has("callable")) {
+            Variant cv = spec["callable"];
+            if (cv.get_type() == Variant::CALLABLE) {
+                Callable cb = cv;
+                Array args;
+                args.push_back(ctx);
+                args.push_back(comp);
+                // script callables get a Dictionary copy of the params (including cast_id)
+                args.push_back(params_with_cast.to_dictionary());
+                args.push_back(spec);
+                // pass the canonical (lowercased) synergy key
+                args.push_back(skey_lower);
+                SPELL_TRACE_SPAN("synergy_callable", cast_number, skey_lower);
+                cb.callv(args);
+            } else if (cv.get_type() == Variant::ARRAY) {
+                Array carray = cv;
+                for (int ci = 0; ci < carray.size(); ++ci) {
+                    Variant item = carray[ci];
+                    if (item.get_type() == Variant::CALLABLE) {
+                        Callable cb = item;
                         Array args;
                         args.push_back(ctx);
                         args.push_back(comp);
-                        // pass a copy of resolved_params augmented with cast_id
-                        Dictionary rp_with_cast = resolved_params;
-                        rp_with_cast["cast_id"] = cast_id;
-                        args.push_back(rp_with_cast);
+                        args.push_back(params_with_cast.to_dictionary());
                         args.push_back(spec);
                         // pass the canonical (lowercased) synergy key
                         args.push_back(skey_lower);
+                        SPELL_TRACE_SPAN("synergy_callable", cast_number, skey_lower);
                         cb.callv(args);
-                    } else if (cv.get_type() == Variant::ARRAY) {
-                        Array carray = cv;
-                        for (int ci = 0; ci < carray.size(); ++ci) {
-                            Variant item = carray[ci];
-                            if (item.get_type() == Variant::CALLABLE) {
-                                Callable cb = item;
-                                Array args;
-                                args.push_back(ctx);
-                                args.push_back(comp);
-                                Dictionary rp_with_cast = resolved_params;
-                                rp_with_cast["cast_id"] = cast_id;
-                                args.push_back(rp_with_cast);
-                                args.push_back(spec);
-                                // pass the canonical (lowercased) synergy key
-                                args.push_back(skey_lower);
-                                cb.callv(args);
-                            }
-                        }
                     }
                 }
-                if (spec.has("extra_executors")) {
-                    Variant ev = spec["extra_executors"];
-                    if (ev.get_type() == Variant::ARRAY) {
-                        Array extras = ev;
-                        UtilityFunctions::print(String("[SpellEngine] synergy '") + skey_lower + "' has extra_executors count=" + String::num(extras.size()));
-                        for (int ei = 0; ei < extras.size(); ++ei) {
-                            Variant exv = extras[ei];
-                            UtilityFunctions::print(String("[SpellEngine] examining extra_executors[") + String::num(ei) + "]:");
-                            UtilityFunctions::print(exv);
-                            if (exv.get_type() != Variant::DICTIONARY) continue;
-                            Dictionary exd = exv;
-
-                            if (exd.has("trigger_on_executor")) {
-                                Variant tov = exd["trigger_on_executor"];
-                                bool trigger_ok = false;
-                                if (tov.get_type() == Variant::STRING) {
-                                    String trig = tov;
-                                    if (trig.to_lower() == comp->get_executor_id().to_lower()) trigger_ok = true;
-                                } else if (tov.get_type() == Variant::ARRAY) {
-                                    Array tarr = tov;
-                                    for (int ti = 0; ti < tarr.size(); ++ti) {
-                                        Variant tv = tarr[ti];
-                                        if (tv.get_type() != Variant::STRING) continue;
-                                        if (((String)tv).to_lower() == comp->get_executor_id().to_lower()) {
-                                            trigger_ok = true; break;
-                                        }
-                                    }
-                                }
-                                if (!trigger_ok) {
-                                    UtilityFunctions::print(String("[SpellEngine] extra_executors entry skipped due to trigger mismatch; expected:"));
-                                    UtilityFunctions::print(exd["trigger_on_executor"]);
-                                    UtilityFunctions::print(String("[SpellEngine] got: ") + comp->get_executor_id());
-                                    continue;
-                                }
-                            }
-
-                            if (!exd.has("executor_id")) continue;
-                            String extra_exec_id = exd["executor_id"];
-
-                            Dictionary extra_params;
-                            bool use_resolved = true;
-                            if (exd.has("use_resolved_params")) {
-                                Variant ur = exd["use_resolved_params"];
-                                if (ur.get_type() == Variant::BOOL) use_resolved = (bool)ur;
-                            }
-                            if (use_resolved) extra_params = resolved_params;
-                            if (exd.has("params_mods")) {
-                                Variant pmv = exd["params_mods"];
-                                if (pmv.get_type() == Variant::DICTIONARY) {
-                                    Dictionary pmd = pmv;
-                                    Array pk = pmd.keys();
-                                    for (int pki = 0; pki < pk.size(); ++pki) {
-                                        String pkey = pk[pki];
-                                        extra_params[pkey] = pmd[pkey];
-                                    }
+            }
+        }
+        if (spec.has("extra_executors")) {
+            Variant ev = spec["extra_executors"];
+            if (ev.get_type() == Variant::ARRAY) {
+                Array extras = ev;
+                SPELL_DEBUG(SpellLog::CHANNEL_SYNERGY, String("[SpellEngine] synergy '") + skey_lower + "' has extra_executors count=" + String::num(extras.size()));
+                for (int ei = 0; ei < extras.size(); ++ei) {
+                    Variant exv = extras[ei];
+                    SPELL_TRACE(SpellLog::CHANNEL_SYNERGY, String("[SpellEngine] examining extra_executors[") + String::num(ei) + "]:");
+                    SPELL_TRACE(SpellLog::CHANNEL_SYNERGY, Variant(exv).stringify());
+                    if (exv.get_type() != Variant::DICTIONARY) continue;
+                    Dictionary exd = exv;
+
+                    if (exd.has("trigger_on_executor")) {
+                        Variant tov = exd["trigger_on_executor"];
+                        bool trigger_ok = false;
+                        if (tov.get_type() == Variant::STRING) {
+                            String trig = tov;
+                            if (trig.to_lower() == comp->get_executor_id().to_lower()) trigger_ok = true;
+                        } else if (tov.get_type() == Variant::ARRAY) {
+                            Array tarr = tov;
+                            for (int ti = 0; ti < tarr.size(); ++ti) {
+                                Variant tv = tarr[ti];
+                                if (tv.get_type() != Variant::STRING) continue;
+                                if (((String)tv).to_lower() == comp->get_executor_id().to_lower()) {
+                                    trigger_ok = true; break;
                                 }
                             }
+                        }
+                        if (!trigger_ok) {
+                            SPELL_DEBUG(SpellLog::CHANNEL_SYNERGY, String("[SpellEngine] extra_executors entry skipped due to trigger mismatch; expected:"));
+                            SPELL_DEBUG(SpellLog::CHANNEL_SYNERGY, Variant(exd["trigger_on_executor"]).stringify());
+                            SPELL_DEBUG(SpellLog::CHANNEL_SYNERGY, String("[SpellEngine] got: ") + comp->get_executor_id());
+                            continue;
+                        }
+                    }
 
-                            bool charge_cost = false;
-                            double extra_cost = 0.0;
-                            if (exd.has("charge_cost")) {
-                                Variant cv = exd["charge_cost"];
-                                if (cv.get_type() == Variant::BOOL) charge_cost = (bool)cv;
-                            }
-                            if (exd.has("cost")) {
-                                Variant ccv = exd["cost"];
-                                if (ccv.get_type() == Variant::INT || ccv.get_type() == Variant::FLOAT) extra_cost = (double)ccv;
-                            }
+                    if (!exd.has("executor_id")) continue;
+                    String extra_exec_id = exd["executor_id"];
 
-                            if (charge_cost && extra_cost > 0.0) {
-                                Dictionary extra_cost_per_aspect;
-                                double sum_shares = 0.0;
-                                Dictionary main_costs;
-                                if (resolved.has("cost_per_aspect")) {
-                                    Variant mv = resolved["cost_per_aspect"];
-                                    if (mv.get_type() == Variant::DICTIONARY) main_costs = mv;
-                                }
+                    ParamBlock extra_params;
+                    bool use_resolved = true;
+                    if (exd.has("use_resolved_params")) {
+                        Variant ur = exd["use_resolved_params"];
+                        if (ur.get_type() == Variant::BOOL) use_resolved = (bool)ur;
+                    }
+                    if (use_resolved) extra_params = params_with_cast;
+                    if (exd.has("params_mods")) {
+                        Variant pmv = exd["params_mods"];
+                        if (pmv.get_type() == Variant::DICTIONARY) extra_params.merge_dictionary(pmv);
+                    }
 
-                                if (main_costs.size() > 0) {
-                                    Array mkeys = main_costs.keys();
-                                    for (int mk = 0; mk < mkeys.size(); ++mk) {
-                                        String a = mkeys[mk];
-                                        if (main_costs.has(a)) {
-                                            Variant vv = main_costs[a];
-                                            if (vv.get_type() == Variant::INT || vv.get_type() == Variant::FLOAT) sum_shares += (double)vv;
-                                        }
-                                    }
-                                }
+                    bool charge_cost = false;
+                    double extra_cost = 0.0;
+                    if (exd.has("charge_cost")) {
+                        Variant cv = exd["charge_cost"];
+                        if (cv.get_type() == Variant::BOOL) charge_cost = (bool)cv;
+                    }
+                    if (exd.has("cost")) {
+                        Variant ccv = exd["cost"];
+                        if (ccv.get_type() == Variant::INT || ccv.get_type() == Variant::FLOAT) extra_cost = (double)ccv;
+                    }
 
-                                for (int ai = 0; ai < aspects_used.size(); ++ai) {
-                                    String a = aspects_used[ai];
-                                    double share = 0.0;
-                                    if (sum_shares > 0.0 && main_costs.has(a)) {
-                                        Variant vv = main_costs[a];
-                                        if (vv.get_type() == Variant::INT || vv.get_type() == Variant::FLOAT) share = (double)vv / sum_shares;
-                                    } else {
-                                        share = 1.0 / (double)aspects_used.size();
-                                    }
-                                    extra_cost_per_aspect[a] = extra_cost * share;
-                                }
+                    if (charge_cost && extra_cost > 0.0) {
+                        Dictionary extra_cost_per_aspect;
+                        double sum_shares = 0.0;
+                        Dictionary main_costs;
+                        if (resolved.has("cost_per_aspect")) {
+                            Variant mv = resolved["cost_per_aspect"];
+                            if (mv.get_type() == Variant::DICTIONARY) main_costs = mv;
+                        }
 
-                                Array ekeys = extra_cost_per_aspect.keys();
-                                bool ok = true;
-                                if (!sc) ok = false;
-                                for (int k = 0; k < ekeys.size() && ok; ++k) {
-                                    String a = ekeys[k];
-                                    double need = (double)extra_cost_per_aspect[a];
-                                    if (!sc->can_deduct(a, need)) ok = false;
-                                }
-                                if (!ok) continue;
-                                for (int k = 0; k < ekeys.size(); ++k) {
-                                    String a = ekeys[k];
-                                    double need = (double)extra_cost_per_aspect[a];
-                                    sc->deduct_mana(a, need);
+                        if (main_costs.size() > 0) {
+                            Array mkeys = main_costs.keys();
+                            for (int mk = 0; mk < mkeys.size(); ++mk) {
+                                String a = mkeys[mk];
+                                if (main_costs.has(a)) {
+                                    Variant vv = main_costs[a];
+                                    if (vv.get_type() == Variant::INT || vv.get_type() == Variant::FLOAT) sum_shares += (double)vv;
                                 }
                             }
+                        }
 
-                            if (reg && reg->has_executor(extra_exec_id)) {
-                                Ref<IExecutor> extra_exec = reg->get_executor(extra_exec_id);
-                                if (extra_exec.is_valid()) {
-                                    // ensure extra executor params include the cast id
-                                    Dictionary extra_with_cast = extra_params;
-                                    extra_with_cast["cast_id"] = cast_id;
-                                    extra_exec->execute(ctx, comp, extra_with_cast);
-                                }
+                        for (int ai = 0; ai < aspects_used.size(); ++ai) {
+                            String a = aspects_used[ai];
+                            double share = 0.0;
+                            if (sum_shares > 0.0 && main_costs.has(a)) {
+                                Variant vv = main_costs[a];
+                                if (vv.get_type() == Variant::INT || vv.get_type() == Variant::FLOAT) share = (double)vv / sum_shares;
+                            } else {
+                                share = 1.0 / (double)aspects_used.size();
                             }
+                            extra_cost_per_aspect[a] = extra_cost * share;
+                        }
+
+                        Array ekeys = extra_cost_per_aspect.keys();
+                        std::vector<std::pair<int, double>> extra_costs;
+                        for (int k = 0; k < ekeys.size(); ++k) {
+                            String a = ekeys[k];
+                            extra_costs.push_back({ InternTable::aspects().intern(a), (double)extra_cost_per_aspect[a] });
+                        }
+                        bool ok = true;
+                        if (!sc) ok = false;
+                        for (size_t k = 0; k < extra_costs.size() && ok; ++k) {
+                            if (!sc->can_deduct_by_id(extra_costs[k].first, extra_costs[k].second)) ok = false;
+                        }
+                        if (!ok) continue;
+                        for (size_t k = 0; k < extra_costs.size(); ++k) {
+                            sc->deduct_mana_by_id(extra_costs[k].first, extra_costs[k].second);
+                        }
+                    }
+
+                    if (reg && reg->has_executor(extra_exec_id)) {
+                        Ref<IExecutor> extra_exec = reg->get_executor(extra_exec_id);
+                        if (extra_exec.is_valid()) {
+                            // ensure extra executor params include the cast id
+                            static const int key_cast_id = ParamBlock::key("cast_id");
+                            extra_params.set(key_cast_id, params_with_cast.get(key_cast_id));
+                            SPELL_TRACE_SPAN("extra_executor", cast_number, extra_exec_id);
+                            extra_exec->execute_block(ctx, comp, extra_params);
+                            SpellStats::count(SpellStats::components_executed);
                         }
                     }
                 }
@@ -333,15 +484,33 @@ void SpellEngine::execute_spell(Ref<Spell> spell, Ref<SpellContext> ctx) {
     }
 }
 
-Dictionary SpellEngine::get_adjusted_mana_costs(Ref<Spell> spell, Ref<SpellContext> ctx) {
+// Helper: fold one component's cost_per_aspect into running per-aspect and overall totals
+static void accumulate_component_costs(const Dictionary &comp_costs, Dictionary &total_per_aspect, double &total_mana) {
+    Array k = comp_costs.keys();
+    for (int ki = 0; ki < k.size(); ++ki) {
+        String a = k[ki];
+        double v = 0.0;
+        Variant vv = comp_costs[a];
+        if (vv.get_type() == Variant::INT || vv.get_type() == Variant::FLOAT) v = (double)vv;
+        if (total_per_aspect.has(a)) total_per_aspect[a] = (double)total_per_aspect[a] + v;
+        else total_per_aspect[a] = v;
+        total_mana += v;
+    }
+}
+
+static Dictionary make_mana_costs_result(const Dictionary &total_per_aspect, double total_mana, const Dictionary &per_component) {
     Dictionary out;
+    out["costs_per_aspect"] = total_per_aspect;
+    out["total_mana"] = total_mana;
+    out["per_component"] = per_component;
+    return out;
+}
+
+Dictionary SpellEngine::get_adjusted_mana_costs(Ref<Spell> spell, Ref<SpellContext> ctx) {
     Dictionary total_per_aspect;
     double total_mana = 0.0;
     if (!spell.is_valid() || !ctx.is_valid()) {
-        out["costs_per_aspect"] = total_per_aspect;
-        out["total_mana"] = total_mana;
-        out["per_component"] = Dictionary();
-        return out;
+        return make_mana_costs_result(total_per_aspect, total_mana, Dictionary());
     }
 
     Array comps_arr = spell->get_components();
@@ -353,15 +522,7 @@ Dictionary SpellEngine::get_adjusted_mana_costs(Ref<Spell> spell, Ref<SpellConte
     if (caster_node) sc_for_resolve = Object::cast_to<SpellCaster>(caster_node);
 
     // Determine casting aspects similar to execute_spell
-    Array casting_aspects;
-    if (ctx_params.has("aspects")) {
-        Variant v = ctx_params["aspects"];
-        if (v.get_type() == Variant::ARRAY) casting_aspects = v;
-    }
-
-    if (casting_aspects.size() == 0 && caster_node) {
-        if (sc_for_resolve) casting_aspects = sc_for_resolve->get_assigned_aspects();
-    }
+    Array casting_aspects = derive_casting_aspects(ctx_params, sc_for_resolve);
 
     for (int i = 0; i < comps_arr.size(); ++i) {
         Ref<SpellComponent> comp = comps_arr[i];
@@ -369,25 +530,137 @@ Dictionary SpellEngine::get_adjusted_mana_costs(Ref<Spell> spell, Ref<SpellConte
         Dictionary resolved = resolve_component_params(comp, casting_aspects, sc_for_resolve, ctx_params);
         Dictionary comp_costs;
         if (resolved.has("cost_per_aspect")) comp_costs = resolved["cost_per_aspect"];
-        Array k = comp_costs.keys();
-        for (int ki = 0; ki < k.size(); ++ki) {
-            String a = k[ki];
-            double v = 0.0;
-            Variant vv = comp_costs[a];
-            if (vv.get_type() == Variant::INT || vv.get_type() == Variant::FLOAT) v = (double)vv;
-            if (total_per_aspect.has(a)) total_per_aspect[a] = (double)total_per_aspect[a] + v;
-            else total_per_aspect[a] = v;
-            total_mana += v;
-        }
+        accumulate_component_costs(comp_costs, total_per_aspect, total_mana);
         per_component[comp->get_executor_id()] = comp_costs;
     }
 
-    out["costs_per_aspect"] = total_per_aspect;
-    out["total_mana"] = total_mana;
-    out["per_component"] = per_component;
+    return make_mana_costs_result(total_per_aspect, total_mana, per_component);
+}
+
+Array SpellEngine::get_adjusted_mana_costs_parallel(const Array &casts) {
+    Array out;
+    out.resize(casts.size());
+
+    // Snapshot every cast's inputs on the calling thread. Workers only read the snapshots,
+    // the components, the caster scalers and the registries; the calling thread blocks
+    // until all of them finish, so none of that state changes underneath them.
+    cost_eval_casts.clear();
+    cost_eval_items.clear();
+    cost_eval_casts.resize(casts.size());
+    for (int i = 0; i < casts.size(); ++i) {
+        Variant entry = casts[i];
+        Ref<Spell> spell;
+        Ref<SpellContext> ctx;
+        if (entry.get_type() == Variant::DICTIONARY) {
+            Dictionary d = entry;
+            spell = d.get("spell", Variant());
+            ctx = d.get("context", Variant());
+        } else if (entry.get_type() == Variant::ARRAY) {
+            Array a = entry;
+            if (a.size() >= 2) {
+                spell = a[0];
+                ctx = a[1];
+            }
+        }
+        CostEvalCast &c = cost_eval_casts[i];
+        if (!spell.is_valid() || !ctx.is_valid()) continue;
+        c.ctx_params = ctx->get_params().duplicate(true);
+        Node *caster_node = ctx->get_caster();
+        if (caster_node) c.caster = Object::cast_to<SpellCaster>(caster_node);
+        c.casting_aspects = derive_casting_aspects(c.ctx_params, c.caster).duplicate();
+
+        Array comps_arr = spell->get_components();
+        for (int ci = 0; ci < comps_arr.size(); ++ci) {
+            Ref<SpellComponent> comp = comps_arr[ci];
+            if (!comp.is_valid()) continue;
+            CostEvalItem item;
+            item.component = comp;
+            item.cast_index = i;
+            cost_eval_items.push_back(item);
+        }
+    }
+
+    cost_eval_results.clear();
+    cost_eval_results.resize(cost_eval_items.size());
+    int count = (int)cost_eval_items.size();
+    WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+    if (wtp && count >= PARALLEL_COST_MIN_ITEMS) {
+        int64_t group = wtp->add_group_task(callable_mp(this, &SpellEngine::_evaluate_cost_item), count, -1, true, "SpellEngine mana cost evaluation");
+        wtp->wait_for_group_task_completion(group);
+    } else {
+        for (int i = 0; i < count; ++i) _evaluate_cost_item((uint32_t)i);
+    }
+
+    // Merge per-component results back into per-cast totals in component order
+    std::vector<Dictionary> totals(casts.size());
+    std::vector<Dictionary> per_components(casts.size());
+    std::vector<double> total_mana(casts.size(), 0.0);
+    for (int i = 0; i < count; ++i) {
+        const CostEvalItem &item = cost_eval_items[i];
+        accumulate_component_costs(cost_eval_results[i], totals[item.cast_index], total_mana[item.cast_index]);
+        per_components[item.cast_index][item.component->get_executor_id()] = cost_eval_results[i];
+    }
+    for (int i = 0; i < casts.size(); ++i) {
+        out[i] = make_mana_costs_result(totals[i], total_mana[i], per_components[i]);
+    }
+
+    cost_eval_items.clear();
+    cost_eval_casts.clear();
+    cost_eval_results.clear();
     return out;
 }
 
+void SpellEngine::_evaluate_cost_item(uint32_t p_index) {
+    const CostEvalItem &item = cost_eval_items[p_index];
+    const CostEvalCast &c = cost_eval_casts[item.cast_index];
+    SPELL_TRACE_SPAN("cost_eval", 0, String());
+    // Always the uncached path: the resolution cache is not safe to touch from workers
+    Dictionary resolved = _resolve_component_params_uncached(item.component, c.casting_aspects, c.caster, c.ctx_params);
+    Dictionary comp_costs;
+    if (resolved.has("cost_per_aspect")) comp_costs = resolved["cost_per_aspect"];
+    cost_eval_results[p_index] = comp_costs;
+}
+
+void SpellEngine::set_trace_enabled(bool enabled) {
+    SpellTrace::set_enabled(enabled);
+}
+
+bool SpellEngine::get_trace_enabled() const {
+    return SpellTrace::is_enabled();
+}
+
+void SpellEngine::clear_trace() {
+    SpellTrace::clear();
+}
+
+int SpellEngine::dump_trace(const String &path) const {
+    return SpellTrace::dump(path);
+}
+
+void SpellEngine::clear_target_capabilities() {
+    TargetCapabilities::clear();
+}
+
+bool SpellEngine::is_spell_inert(Object *node) const {
+    return node && InertRegistry::is_inert(node->get_instance_id());
+}
+
+void SpellEngine::begin_damage_batch() {
+    DamageAccumulator::begin();
+}
+
+void SpellEngine::end_damage_batch() {
+    DamageAccumulator::end();
+}
+
+Dictionary SpellEngine::get_stats() const {
+    return SpellStats::get_stats();
+}
+
+void SpellEngine::reset_stats() {
+    SpellStats::reset();
+}
+
 void SpellEngine::set_verbose_composition(bool v) {
     verbose_composition = v;
 }
@@ -396,7 +669,135 @@ bool SpellEngine::get_verbose_composition() const {
     return verbose_composition;
 }
 
+void SpellEngine::set_resolution_cache_enabled(bool enabled) {
+    resolution_cache_enabled = enabled;
+    if (!enabled) {
+        resolution_cache.clear();
+        resolution_lru.clear();
+    }
+}
+
+bool SpellEngine::get_resolution_cache_enabled() const {
+    return resolution_cache_enabled;
+}
+
+void SpellEngine::set_resolution_cache_capacity(int capacity) {
+    resolution_cache_capacity = capacity > 0 ? capacity : 1;
+    _trim_resolution_cache(resolution_cache_capacity);
+}
+
+int SpellEngine::get_resolution_cache_capacity() const {
+    return resolution_cache_capacity;
+}
+
+void SpellEngine::clear_resolution_cache() {
+    resolution_cache.clear();
+    resolution_lru.clear();
+    resolution_cache_hits = 0;
+    resolution_cache_misses = 0;
+}
+
+Dictionary SpellEngine::get_resolution_cache_stats() const {
+    Dictionary out;
+    out["hits"] = (int64_t)resolution_cache_hits;
+    out["misses"] = (int64_t)resolution_cache_misses;
+    out["entries"] = (int64_t)resolution_cache.size();
+    return out;
+}
+
+// Helper: boost-style hash combine for resolution cache keys
+void SpellEngine::_trim_resolution_cache(int max_entries) {
+    while ((int)resolution_cache.size() > max_entries && !resolution_lru.empty()) {
+        resolution_cache.erase(resolution_lru.back());
+        resolution_lru.pop_back();
+    }
+}
+
+static inline uint64_t hash_combine_u64(uint64_t h, uint64_t v) {
+    return h ^ (v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
 Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component, const Array &casting_aspects, SpellCaster *caster, const Dictionary &ctx_params) {
+    if (!component.is_valid()) return Dictionary();
+    if (!resolution_cache_enabled || verbose_composition) {
+        return _resolve_component_params_uncached(component, casting_aspects, caster, ctx_params);
+    }
+    Dictionary shared;
+    _resolve_shared(component, casting_aspects, caster, ctx_params, shared, nullptr);
+    return shared.duplicate(true);
+}
+
+void SpellEngine::_resolve_shared(const Ref<SpellComponent> &component, const Array &casting_aspects, SpellCaster *caster, const Dictionary &ctx_params, Dictionary &r_resolved, ParamBlock *r_params) {
+    if (!component.is_valid()) {
+        r_resolved = Dictionary();
+        if (r_params) r_params->clear();
+        return;
+    }
+    if (!resolution_cache_enabled || verbose_composition) {
+        r_resolved = _resolve_component_params_uncached(component, casting_aspects, caster, ctx_params);
+        if (r_params) *r_params = ParamBlock::from_dictionary(r_resolved.get("resolved_params", Dictionary()));
+        return;
+    }
+
+    SynergyRegistry *sreg = SynergyRegistry::get_singleton();
+    uint64_t synergy_revision = sreg ? sreg->get_revision() : 0;
+    uint64_t caster_id = caster ? (uint64_t)caster->get_instance_id() : 0;
+    uint64_t caster_scaler_version = caster ? caster->get_scaler_version() : 0;
+    // only merge_modes in the context params affects resolution
+    Variant merge_modes = ctx_params.has("merge_modes") ? ctx_params["merge_modes"] : Variant();
+
+    uint64_t key = (uint64_t)(uintptr_t)component.ptr();
+    key = hash_combine_u64(key, component->get_version());
+    key = hash_combine_u64(key, caster_id);
+    key = hash_combine_u64(key, caster_scaler_version);
+    key = hash_combine_u64(key, synergy_revision);
+    key = hash_combine_u64(key, config_revision);
+    key = hash_combine_u64(key, (uint64_t)Variant(casting_aspects).hash());
+    key = hash_combine_u64(key, (uint64_t)merge_modes.hash());
+
+    auto it = resolution_cache.find(key);
+    if (it != resolution_cache.end()) {
+        const ResolutionCacheEntry &e = it->second;
+        if (e.component == component && e.component_version == component->get_version() &&
+                e.caster_id == caster_id && e.caster_scaler_version == caster_scaler_version &&
+                e.synergy_revision == synergy_revision && e.config_revision == config_revision &&
+                e.casting_aspects == casting_aspects && e.merge_modes == merge_modes) {
+            resolution_cache_hits += 1;
+            resolution_lru.splice(resolution_lru.begin(), resolution_lru, e.lru_pos);
+            r_resolved = e.result;
+            if (r_params) *r_params = e.params;
+            return;
+        }
+    }
+
+    resolution_cache_misses += 1;
+    Dictionary out = _resolve_component_params_uncached(component, casting_aspects, caster, ctx_params);
+
+    if (it != resolution_cache.end()) {
+        // stale entry or hash collision: replace it in place
+        resolution_lru.erase(it->second.lru_pos);
+        resolution_cache.erase(it);
+    }
+    _trim_resolution_cache(resolution_cache_capacity - 1);
+    ResolutionCacheEntry e;
+    e.component = component;
+    e.component_version = component->get_version();
+    e.caster_id = caster_id;
+    e.caster_scaler_version = caster_scaler_version;
+    e.synergy_revision = synergy_revision;
+    e.config_revision = config_revision;
+    e.casting_aspects = casting_aspects.duplicate();
+    e.merge_modes = merge_modes.duplicate(true);
+    e.result = out;
+    e.params = ParamBlock::from_dictionary(out.get("resolved_params", Dictionary()));
+    if (r_params) *r_params = e.params;
+    resolution_lru.push_front(key);
+    e.lru_pos = resolution_lru.begin();
+    resolution_cache.emplace(key, std::move(e));
+    r_resolved = out;
+}
+
+Dictionary SpellEngine::_resolve_component_params_uncached(Ref<SpellComponent> component, const Array &casting_aspects, SpellCaster *caster, const Dictionary &ctx_params) {
     Dictionary out;
     if (!component.is_valid()) return out;
 
@@ -447,12 +848,36 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
     Dictionary aspect_mods = component->get_aspect_modifiers();
     Dictionary resolved_params;
 
+    // Fetch each aspect's single-aspect synergy default_scalers once, via the bitmask index,
+    // rather than per parameter key.
+    std::vector<Dictionary> single_aspect_scalers(aspects_used.size());
+    SynergyRegistry *sreg_single = SynergyRegistry::get_singleton();
+    if (sreg_single) {
+        for (int i = 0; i < aspects_used.size(); ++i) {
+            Dictionary spec_single;
+            if (!sreg_single->find_synergy_for_aspect(aspects_used[i], spec_single)) continue;
+            if (spec_single.has("default_scalers") && spec_single["default_scalers"].get_type() == Variant::DICTIONARY) {
+                single_aspect_scalers[i] = spec_single["default_scalers"];
+            }
+        }
+    }
+
+    // Caster scalers are read by interned id; look the aspect ids up once per resolve.
+    // find() only takes the table's shared lock, so this stays safe on planner worker threads.
+    std::vector<int> aspect_ids(aspects_used.size(), -1);
+    if (caster) {
+        const InternTable &aspect_table = InternTable::aspects();
+        for (int i = 0; i < aspects_used.size(); ++i) aspect_ids[i] = aspect_table.find(aspects_used[i]);
+    }
+    const InternTable &param_table = InternTable::params();
+
     Array base_keys = base.keys();
     for (int k = 0; k < base_keys.size(); ++k) {
         Variant key = base_keys[k];
         Variant base_val = base[key];
         if (base_val.get_type() == Variant::INT || base_val.get_type() == Variant::FLOAT) {
             double base_num = (double)base_val;
+            int param_id = caster ? param_table.find((String)key) : -1;
             double acc = 0.0;
             if (verbose_composition) {
                 UtilityFunctions::print(String("[SpellEngine] composing param '") + (String)key + "' base=" + String::num((double)base_val));
@@ -488,30 +913,17 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
                 bool found_aspect_default = false;
                 // Prefer default scalers from the Synergy resource for the single aspect.
                 // Aspect resources are treated as presentation-only (text/visuals).
-                SynergyRegistry *sreg_single = SynergyRegistry::get_singleton();
-                if (sreg_single) {
-                    String lookup_key = a;
-                    if (!sreg_single->has_synergy(lookup_key)) lookup_key = a.to_lower();
-                    if (sreg_single->has_synergy(lookup_key)) {
-                        Dictionary spec_single = sreg_single->get_synergy(lookup_key);
-                        if (spec_single.has("default_scalers")) {
-                            Variant sv = spec_single["default_scalers"];
-                            if (sv.get_type() == Variant::DICTIONARY) {
-                                Dictionary sdefs = sv;
-                                if (sdefs.has((String)key)) {
-                                    Variant dv = sdefs[(String)key];
-                                    if (dv.get_type() == Variant::INT || dv.get_type() == Variant::FLOAT) {
-                                        aspect_default = (double)dv;
-                                        found_aspect_default = true;
-                                    }
-                                }
-                            }
-                        }
+                const Dictionary &sdefs = single_aspect_scalers[i];
+                if (sdefs.has(key)) {
+                    Variant dv = sdefs[key];
+                    if (dv.get_type() == Variant::INT || dv.get_type() == Variant::FLOAT) {
+                        aspect_default = (double)dv;
+                        found_aspect_default = true;
                     }
                 }
 
                 double caster_scaler = 1.0;
-                if (caster) caster_scaler = caster->get_scaler(a, (String)key);
+                if (caster) caster_scaler = caster->get_scaler_by_id(aspect_ids[i], param_id);
 
                 // determine merge mode: prefer context override, else engine default, else overwrite
                 int mode = MERGE_OVERWRITE;
@@ -557,6 +969,7 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
     // Apply per-aspect and caster scalers to mana_cost even if mana_cost wasn't present in base.
     // Compute a merged multiplier across aspects (weighted by normalized shares).
     double mana_scaler_mult = 0.0;
+    int mana_cost_param_id = caster ? param_table.find("mana_cost") : -1;
     for (int i = 0; i < aspects_used.size(); ++i) {
         String a = aspects_used[i];
         double share = (double)normalized[a];
@@ -564,27 +977,14 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
         double aspect_default = 1.0;
         bool found_aspect_default = false;
         // Prefer mana_cost default scalers from the single-aspect Synergy resource.
-        SynergyRegistry *sreg_single_mc = SynergyRegistry::get_singleton();
-        if (sreg_single_mc) {
-            String lookup_key = a;
-            if (!sreg_single_mc->has_synergy(lookup_key)) lookup_key = a.to_lower();
-            if (sreg_single_mc->has_synergy(lookup_key)) {
-                Dictionary spec_single = sreg_single_mc->get_synergy(lookup_key);
-                if (spec_single.has("default_scalers")) {
-                    Variant sv = spec_single["default_scalers"];
-                    if (sv.get_type() == Variant::DICTIONARY) {
-                        Dictionary sdefs = sv;
-                        if (sdefs.has("mana_cost")) {
-                            Variant dv = sdefs["mana_cost"];
-                            if (dv.get_type() == Variant::INT || dv.get_type() == Variant::FLOAT) aspect_default = (double)dv;
-                        }
-                    }
-                }
-            }
+        const Dictionary &sdefs = single_aspect_scalers[i];
+        if (sdefs.has("mana_cost")) {
+            Variant dv = sdefs["mana_cost"];
+            if (dv.get_type() == Variant::INT || dv.get_type() == Variant::FLOAT) aspect_default = (double)dv;
         }
 
         double caster_scaler = 1.0;
-        if (caster) caster_scaler = caster->get_scaler(a, "mana_cost");
+        if (caster) caster_scaler = caster->get_scaler_by_id(aspect_ids[i], mana_cost_param_id);
 
         // resolve merge mode for mana_cost (context override -> engine default -> overwrite)
         int mode = MERGE_OVERWRITE;
@@ -652,23 +1052,27 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
     }
 
     Dictionary synergy_mods = component->get_synergy_modifiers();
-    if (synergy_mods.size() > 0 || SynergyRegistry::get_singleton()->get_synergy_keys().size() > 0) {
-        Array sorted = aspects_used.duplicate();
-        sorted.sort();
+    SynergyRegistry *sreg = SynergyRegistry::get_singleton();
+    if (synergy_mods.size() > 0 || (sreg && sreg->get_synergy_count() > 0)) {
+        // Component-level synergy_modifiers are keyed by the "+"-joined aspect string, so only
+        // build it when the component declares any; registry lookups go through the bitmask index.
         String key = "";
-        for (int i = 0; i < sorted.size(); ++i) {
-            if (i) key += "+";
-            key += (String)sorted[i];
+        String key_lower = "";
+        if (synergy_mods.size() > 0) {
+            Array sorted = aspects_used.duplicate();
+            sorted.sort();
+            for (int i = 0; i < sorted.size(); ++i) {
+                if (i) key += "+";
+                key += (String)sorted[i];
+            }
+            // accept either the original-cased key or the lowercased form for backwards compatibility
+            key_lower = key.to_lower();
         }
-    // normalize combined key to lowercase for registry lookups (synergies are registered with
-    // lowercase keys). When checking component-level synergy_modifiers, accept either the
-    // original-cased key or the lowercased form for backwards compatibility.
-    String key_lower = key.to_lower();
-    UtilityFunctions::print(String("[SpellEngine] combined synergy key built: '") + key + "' -> '" + key_lower + "'");
 
         if (synergy_mods.size() > 0 && (synergy_mods.has(key) || synergy_mods.has(key_lower))) {
-            Variant sv = synergy_mods[key];
-            if (!sv.get_type() || sv.get_type() == Variant::NIL) sv = synergy_mods[key_lower];
+            // use get() so a missing case variant is not inserted into the component's dictionary
+            Variant sv = synergy_mods.get(key, Variant());
+            if (sv.get_type() == Variant::NIL) sv = synergy_mods.get(key_lower, Variant());
             if (sv.get_type() == Variant::DICTIONARY) {
                 Dictionary sm = sv;
                 Array sk = sm.keys();
@@ -679,11 +1083,11 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
             }
         }
 
-        SynergyRegistry *sreg = SynergyRegistry::get_singleton();
         if (sreg) {
-            if (sreg->has_synergy(key_lower)) {
-                UtilityFunctions::print(String("[SpellEngine] found synergy in registry for key: ") + key_lower);
-                Dictionary spec = sreg->get_synergy(key_lower);
+            Dictionary spec;
+            String combined_key;
+            if (sreg->find_synergy_for_aspects(aspects_used, spec, &combined_key)) {
+                if (verbose_composition) UtilityFunctions::print(String("[SpellEngine] found synergy in registry for key: ") + combined_key);
                 // Apply synergy-level default_scalers (scale existing numeric resolved params)
                 // Only apply combined-key synergy scalers when multiple aspects are involved.
                 // Single-aspect defaults are already sourced per-aspect above from the
@@ -737,8 +1141,8 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
                     }
                 }
             }
-            else {
-                UtilityFunctions::print(String("[SpellEngine] no combined-key synergy found for: ") + key_lower);
+            else if (verbose_composition) {
+                UtilityFunctions::print(String("[SpellEngine] no combined-key synergy found for: ") + SynergyRegistry::make_combined_key(aspects_used));
             }
         }
     }
@@ -752,19 +1156,45 @@ Dictionary SpellEngine::resolve_component_params(Ref<SpellComponent> component,
 void SpellEngine::_bind_methods() {
     ClassDB::bind_method(D_METHOD("build_spell_from_aspects", "aspects"), &SpellEngine::build_spell_from_aspects);
     ClassDB::bind_method(D_METHOD("execute_spell", "spell", "context"), &SpellEngine::execute_spell);
+    ClassDB::bind_method(D_METHOD("compile_spell", "spell"), &SpellEngine::compile_spell);
+    ClassDB::bind_method(D_METHOD("compile_template", "template"), &SpellEngine::compile_template);
+    ClassDB::bind_method(D_METHOD("execute_compiled", "plan", "context"), &SpellEngine::execute_compiled);
+    ClassDB::bind_method(D_METHOD("execute_spells_batch", "casts"), &SpellEngine::execute_spells_batch);
+    ClassDB::bind_method(D_METHOD("execute_spells_batch_typed", "spells", "contexts"), &SpellEngine::execute_spells_batch_typed);
     ClassDB::bind_method(D_METHOD("set_default_merge_mode", "key", "mode"), &SpellEngine::set_default_merge_mode);
     ClassDB::bind_method(D_METHOD("get_default_merge_mode", "key"), &SpellEngine::get_default_merge_mode);
     ClassDB::bind_method(D_METHOD("set_merge_mode_mana_multiplier", "mode", "multiplier"), &SpellEngine::set_merge_mode_mana_multiplier);
     ClassDB::bind_method(D_METHOD("get_merge_mode_mana_multiplier", "mode"), &SpellEngine::get_merge_mode_mana_multiplier);
     ClassDB::bind_method(D_METHOD("get_adjusted_mana_costs", "spell", "context"), &SpellEngine::get_adjusted_mana_costs);
+    ClassDB::bind_method(D_METHOD("resolve_component_params", "component", "casting_aspects", "caster", "ctx_params"), &SpellEngine::resolve_component_params, DEFVAL(Variant()), DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("get_adjusted_mana_costs_parallel", "casts"), &SpellEngine::get_adjusted_mana_costs_parallel);
     ClassDB::bind_method(D_METHOD("collect_controls", "spell", "context"), &SpellEngine::collect_controls);
     ClassDB::bind_method(D_METHOD("validate_control_result", "mode", "result"), &SpellEngine::validate_control_result);
     ClassDB::bind_method(D_METHOD("resolve_controls", "spell", "context", "parent", "on_complete"), &SpellEngine::resolve_controls);
     ClassDB::bind_method(D_METHOD("_resolve_controls_forward", "out", "orch", "orig_cb"), &SpellEngine::_resolve_controls_forward);
+    ClassDB::bind_method(D_METHOD("set_trace_enabled", "enabled"), &SpellEngine::set_trace_enabled);
+    ClassDB::bind_method(D_METHOD("get_trace_enabled"), &SpellEngine::get_trace_enabled);
+    ClassDB::bind_method(D_METHOD("clear_trace"), &SpellEngine::clear_trace);
+    ClassDB::bind_method(D_METHOD("dump_trace", "path"), &SpellEngine::dump_trace);
+    ClassDB::bind_method(D_METHOD("clear_target_capabilities"), &SpellEngine::clear_target_capabilities);
+    ClassDB::bind_method(D_METHOD("is_spell_inert", "node"), &SpellEngine::is_spell_inert);
+    ClassDB::bind_method(D_METHOD("begin_damage_batch"), &SpellEngine::begin_damage_batch);
+    ClassDB::bind_method(D_METHOD("end_damage_batch"), &SpellEngine::end_damage_batch);
+    ClassDB::bind_method(D_METHOD("get_stats"), &SpellEngine::get_stats);
+    ClassDB::bind_method(D_METHOD("reset_stats"), &SpellEngine::reset_stats);
     ClassDB::bind_method(D_METHOD("set_verbose_composition", "enabled"), &SpellEngine::set_verbose_composition);
     ClassDB::bind_method(D_METHOD("get_verbose_composition"), &SpellEngine::get_verbose_composition);
     ADD_PROPERTY(PropertyInfo(Variant::BOOL, "verbose_composition"), "set_verbose_composition", "get_verbose_composition");
 
+    ClassDB::bind_method(D_METHOD("set_resolution_cache_enabled", "enabled"), &SpellEngine::set_resolution_cache_enabled);
+    ClassDB::bind_method(D_METHOD("get_resolution_cache_enabled"), &SpellEngine::get_resolution_cache_enabled);
+    ClassDB::bind_method(D_METHOD("set_resolution_cache_capacity", "capacity"), &SpellEngine::set_resolution_cache_capacity);
+    ClassDB::bind_method(D_METHOD("get_resolution_cache_capacity"), &SpellEngine::get_resolution_cache_capacity);
+    ClassDB::bind_method(D_METHOD("clear_resolution_cache"), &SpellEngine::clear_resolution_cache);
+    ClassDB::bind_method(D_METHOD("get_resolution_cache_stats"), &SpellEngine::get_resolution_cache_stats);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "resolution_cache_enabled"), "set_resolution_cache_enabled", "get_resolution_cache_enabled");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "resolution_cache_capacity"), "set_resolution_cache_capacity", "get_resolution_cache_capacity");
+
 }
 
 void SpellEngine::resolve_controls(Ref<Spell> spell, Ref<SpellContext> ctx, Node *parent, const Callable &on_complete) {
@@ -851,47 +1281,46 @@ void SpellEngine::resolve_controls(Ref<Spell> spell, Ref<SpellContext> ctx, Node
 
 void SpellEngine::execute_components_range(Ref<Spell> spell, Ref<SpellContext> ctx, int start, int end) {
     if (!spell.is_valid() || !ctx.is_valid()) return;
-    TypedArray<Ref<SpellComponent>> comps = spell->get_components();
+    Ref<CompiledSpell> plan = compile_spell(spell);
     if (start < 0) start = 0;
-    if (end > comps.size()) end = comps.size();
+    if (end > plan->get_source_component_count()) end = plan->get_source_component_count();
     if (start >= end) return;
 
+    DamageBatchScope damage_batch;
+
     Node *caster_node = ctx->get_caster();
     SpellCaster *sc_for_resolve = nullptr;
     if (caster_node) sc_for_resolve = Object::cast_to<SpellCaster>(caster_node);
 
-    ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
-
-    for (int i = start; i < end; ++i) {
-        Ref<SpellComponent> comp = comps[i];
-        if (!comp.is_valid()) continue;
+    const std::vector<CompiledSpell::Step> &steps = plan->get_steps();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const CompiledSpell::Step &step = steps[i];
+        if (step.source_index < start) continue;
+        if (step.source_index >= end) break;
+        Ref<SpellComponent> comp = step.component;
 
-        Dictionary resolved = resolve_component_params(comp, Array(), sc_for_resolve, ctx->get_params());
-        Dictionary resolved_params;
-        if (resolved.has("resolved_params")) resolved_params = resolved["resolved_params"];
+        Dictionary resolved;
+        ParamBlock params;
+        _resolve_shared(comp, Array(), sc_for_resolve, ctx->get_params(), resolved, &params);
 
         // execute if registered
-        String exec_id = comp->get_executor_id();
-        if (reg && reg->has_executor(exec_id)) {
-            Ref<IExecutor> exec = reg->get_executor(exec_id);
-            if (exec.is_valid()) {
-                // ensure the resolved params carry a cast id so targets can group events
-                cast_counter += 1;
-                String cast_id = "spell_cast_" + String::num(cast_counter);
-                Dictionary rp_with_cast = resolved_params;
-                rp_with_cast["cast_id"] = cast_id;
-                exec->execute(ctx, comp, rp_with_cast);
-                // If an executor signalled failure through the context, abort further execution
-                if (ctx.is_valid()) {
-                    Dictionary r = ctx->get_results();
-                    if (r.has("executor_failed")) {
-                        UtilityFunctions::print(String("SpellEngine: executor '") + comp->get_executor_id() + "' signalled failure; aborting remaining components");
-                        return;
-                    }
+        if (step.executor.is_valid()) {
+            // ensure the resolved params carry a cast id so targets can group events
+            cast_counter += 1;
+            params.set("cast_id", "spell_cast_" + String::num(cast_counter));
+            SPELL_TRACE_SPAN("execute", cast_counter, step.executor_id);
+            step.executor->execute_block(ctx, comp, params);
+            SpellStats::count(SpellStats::components_executed);
+            // If an executor signalled failure through the context, abort further execution
+            if (ctx.is_valid()) {
+                Dictionary r = ctx->get_results();
+                if (r.has("executor_failed")) {
+                    SPELL_WARN(SpellLog::CHANNEL_ENGINE, String("SpellEngine: executor '") + step.executor_id + "' signalled failure; aborting remaining components");
+                    return;
                 }
             }
         } else {
-            UtilityFunctions::print(String("SpellEngine: no executor registered for: ") + exec_id);
+            SPELL_WARN(SpellLog::CHANNEL_ENGINE, String("SpellEngine: no executor registered for: ") + step.executor_id);
         }
     }
 }
@@ -899,41 +1328,34 @@ void SpellEngine::execute_components_range(Ref<Spell> spell, Ref<SpellContext> c
 void SpellEngine::execute_control_components(Ref<Spell> spell, Ref<SpellContext> ctx) {
     if (!spell.is_valid() || !ctx.is_valid()) return;
 
+    DamageBatchScope damage_batch;
+
     Node *caster_node = ctx->get_caster();
     SpellCaster *sc_for_resolve = nullptr;
     if (caster_node) sc_for_resolve = Object::cast_to<SpellCaster>(caster_node);
 
-    TypedArray<Ref<SpellComponent>> comps = spell->get_components();
-    ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
-
-    for (int i = 0; i < comps.size(); ++i) {
-        Ref<SpellComponent> comp = comps[i];
-        if (!comp.is_valid()) continue;
-        String comp_exec_id = comp->get_executor_id();
+    Ref<CompiledSpell> plan = compile_spell(spell);
+    const std::vector<CompiledSpell::Step> &steps = plan->get_steps();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const CompiledSpell::Step &step = steps[i];
         // Only execute control-only components here (those that begin with choose_/select_)
-        if (!(comp_exec_id.begins_with("choose_") || comp_exec_id.begins_with("select_"))) {
-            continue;
-        }
+        if (!step.is_control) continue;
+        Ref<SpellComponent> comp = step.component;
 
         // Resolve params for this component now that ctx may contain control results
-        Dictionary resolved = resolve_component_params(comp, Array(), sc_for_resolve, ctx->get_params());
-        Dictionary resolved_params;
-        if (resolved.has("resolved_params")) resolved_params = resolved["resolved_params"];
-
-        ExecutorRegistry *ereg = ExecutorRegistry::get_singleton();
-        if (ereg && ereg->has_executor(comp_exec_id)) {
-            Ref<IExecutor> exec = ereg->get_executor(comp_exec_id);
-            if (exec.is_valid()) {
-                // ensure the resolved params carry a cast id if not already present
-                Dictionary rp_with_cast = resolved_params;
-                // provide a unique cast id if missing
-                cast_counter += 1;
-                String cast_id = "spell_cast_" + String::num(cast_counter);
-                rp_with_cast["cast_id"] = cast_id;
-                exec->execute(ctx, comp, rp_with_cast);
-            }
+        Dictionary resolved;
+        ParamBlock params;
+        _resolve_shared(comp, Array(), sc_for_resolve, ctx->get_params(), resolved, &params);
+
+        if (step.executor.is_valid()) {
+            // provide a unique cast id for this control execution
+            cast_counter += 1;
+            params.set("cast_id", "spell_cast_" + String::num(cast_counter));
+            SPELL_TRACE_SPAN("execute", cast_counter, step.executor_id);
+            step.executor->execute_block(ctx, comp, params);
+            SpellStats::count(SpellStats::components_executed);
         } else {
-            UtilityFunctions::print(String("SpellEngine: no executor registered for control component: ") + comp_exec_id);
+            SPELL_WARN(SpellLog::CHANNEL_ENGINE, String("SpellEngine: no executor registered for control component: ") + step.executor_id);
         }
     }
 }
@@ -959,26 +1381,19 @@ Array SpellEngine::collect_controls(Ref<Spell> spell, Ref<SpellContext> ctx) {
     Array out;
     if (!spell.is_valid()) return out;
 
-    TypedArray<Ref<SpellComponent>> comps = spell->get_components();
-    ExecutorRegistry *reg = ExecutorRegistry::get_singleton();
-
-    for (int i = 0; i < comps.size(); ++i) {
-        Ref<SpellComponent> comp = comps[i];
-        if (!comp.is_valid()) continue;
-        String exec_id = comp->get_executor_id();
+    Ref<CompiledSpell> plan = compile_spell(spell);
+    const std::vector<CompiledSpell::Step> &steps = plan->get_steps();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const CompiledSpell::Step &step = steps[i];
         // simple heuristic: control executors are those starting with "choose_" or "select_"
-        if (exec_id.begins_with("choose_") || exec_id.begins_with("select_")) {
-            Dictionary d;
-            d["index"] = i;
-            d["executor_id"] = exec_id;
-            d["base_params"] = comp->get_base_params();
-            // query param schema from registry if available
-            if (reg && reg->has_executor(exec_id)) {
-                Ref<IExecutor> ex = reg->get_executor(exec_id);
-                if (ex.is_valid()) d["param_schema"] = ex->get_param_schema();
-            }
-            out.append(d);
-        }
+        if (!step.is_control) continue;
+        Dictionary d;
+        d["index"] = step.source_index;
+        d["executor_id"] = step.executor_id;
+        d["base_params"] = step.component->get_base_params();
+        // param schema from the executor resolved at compile time, if available
+        if (step.executor.is_valid()) d["param_schema"] = step.executor->get_param_schema();
+        out.append(d);
     }
     return out;
 }
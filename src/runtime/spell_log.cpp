@@ -0,0 +1,132 @@
+#include "spellengine/spell_log.hpp"
+
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+#include <mutex>
+
+using namespace godot;
+
+std::atomic<uint8_t> SpellLog::channel_levels[SpellLog::CHANNEL_MAX] = {
+    { LEVEL_WARN }, { LEVEL_WARN }, { LEVEL_WARN }, { LEVEL_WARN }, { LEVEL_WARN }, { LEVEL_WARN }, { LEVEL_WARN },
+};
+std::atomic<bool> SpellLog::echo{ true };
+
+namespace {
+struct LogEntry {
+    uint8_t channel = 0;
+    uint8_t level = 0;
+    uint64_t time_usec = 0;
+    String message;
+};
+
+const char *CHANNEL_NAMES[SpellLog::CHANNEL_MAX] = {
+    "engine", "synergy", "executor", "summon", "force", "registry", "control",
+};
+
+// Ring storage is only touched from write()/get_entries()/clear_entries() under the lock.
+std::mutex &ring_mutex() {
+    static std::mutex m;
+    return m;
+}
+LogEntry *ring_entries() {
+    static LogEntry entries[SpellLog::RING_CAPACITY];
+    return entries;
+}
+int ring_head = 0;
+int ring_count = 0;
+} // namespace
+
+void SpellLog::write(int channel, int level, const String &message) {
+    if (channel < 0 || channel >= CHANNEL_MAX) return;
+    uint64_t now = Time::get_singleton() ? Time::get_singleton()->get_ticks_usec() : 0;
+    {
+        std::lock_guard<std::mutex> lock(ring_mutex());
+        LogEntry &e = ring_entries()[ring_head];
+        e.channel = (uint8_t)channel;
+        e.level = (uint8_t)level;
+        e.time_usec = now;
+        e.message = message;
+        ring_head = (ring_head + 1) % RING_CAPACITY;
+        if (ring_count < RING_CAPACITY) ring_count += 1;
+    }
+    if (echo.load(std::memory_order_relaxed)) {
+        UtilityFunctions::print(String("[") + CHANNEL_NAMES[channel] + "] " + message);
+    }
+}
+
+void SpellLog::set_channel_level(int channel, int level) {
+    if (channel < 0 || channel >= CHANNEL_MAX) return;
+    if (level < LEVEL_ERROR) level = LEVEL_ERROR;
+    if (level > LEVEL_TRACE) level = LEVEL_TRACE;
+    channel_levels[channel].store((uint8_t)level, std::memory_order_relaxed);
+}
+
+int SpellLog::get_channel_level(int channel) {
+    if (channel < 0 || channel >= CHANNEL_MAX) return LEVEL_ERROR;
+    return channel_levels[channel].load(std::memory_order_relaxed);
+}
+
+void SpellLog::set_all_channel_levels(int level) {
+    for (int i = 0; i < CHANNEL_MAX; ++i) set_channel_level(i, level);
+}
+
+void SpellLog::set_echo(bool enabled) {
+    echo.store(enabled, std::memory_order_relaxed);
+}
+
+bool SpellLog::get_echo() {
+    return echo.load(std::memory_order_relaxed);
+}
+
+int SpellLog::get_compiled_max_level() {
+    return SPELLENGINE_LOG_MAX_LEVEL;
+}
+
+Array SpellLog::get_entries() {
+    Array out;
+    std::lock_guard<std::mutex> lock(ring_mutex());
+    int start = (ring_head - ring_count + RING_CAPACITY) % RING_CAPACITY;
+    for (int i = 0; i < ring_count; ++i) {
+        const LogEntry &e = ring_entries()[(start + i) % RING_CAPACITY];
+        Dictionary d;
+        d["channel"] = (int)e.channel;
+        d["level"] = (int)e.level;
+        d["time_usec"] = e.time_usec;
+        d["message"] = e.message;
+        out.push_back(d);
+    }
+    return out;
+}
+
+void SpellLog::clear_entries() {
+    std::lock_guard<std::mutex> lock(ring_mutex());
+    for (int i = 0; i < RING_CAPACITY; ++i) ring_entries()[i].message = String();
+    ring_head = 0;
+    ring_count = 0;
+}
+
+void SpellLog::_bind_methods() {
+    ClassDB::bind_static_method("SpellLog", D_METHOD("set_channel_level", "channel", "level"), &SpellLog::set_channel_level);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("get_channel_level", "channel"), &SpellLog::get_channel_level);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("set_all_channel_levels", "level"), &SpellLog::set_all_channel_levels);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("set_echo", "enabled"), &SpellLog::set_echo);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("get_echo"), &SpellLog::get_echo);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("get_compiled_max_level"), &SpellLog::get_compiled_max_level);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("get_entries"), &SpellLog::get_entries);
+    ClassDB::bind_static_method("SpellLog", D_METHOD("clear_entries"), &SpellLog::clear_entries);
+
+    BIND_ENUM_CONSTANT(CHANNEL_ENGINE);
+    BIND_ENUM_CONSTANT(CHANNEL_SYNERGY);
+    BIND_ENUM_CONSTANT(CHANNEL_EXECUTOR);
+    BIND_ENUM_CONSTANT(CHANNEL_SUMMON);
+    BIND_ENUM_CONSTANT(CHANNEL_FORCE);
+    BIND_ENUM_CONSTANT(CHANNEL_REGISTRY);
+    BIND_ENUM_CONSTANT(CHANNEL_CONTROL);
+    BIND_ENUM_CONSTANT(LEVEL_ERROR);
+    BIND_ENUM_CONSTANT(LEVEL_WARN);
+    BIND_ENUM_CONSTANT(LEVEL_INFO);
+    BIND_ENUM_CONSTANT(LEVEL_DEBUG);
+    BIND_ENUM_CONSTANT(LEVEL_TRACE);
+}
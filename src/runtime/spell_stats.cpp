@@ -0,0 +1,150 @@
+#include "spellengine/spell_stats.hpp"
+
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include "spellengine/spell_trace.hpp"
+
+using namespace godot;
+
+void LatencyHistogram::record(uint64_t usec) {
+    int bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && usec >= ((uint64_t)1 << bucket)) bucket++;
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    total_usec.fetch_add(usec, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::percentile(double q) const {
+    uint64_t n = count.load(std::memory_order_relaxed);
+    if (n == 0) return 0.0;
+    uint64_t target = (uint64_t)(q * (double)n);
+    if (target < 1) target = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) return i == 0 ? 0.0 : (double)((uint64_t)1 << i);
+    }
+    return (double)((uint64_t)1 << (BUCKET_COUNT - 1));
+}
+
+void LatencyHistogram::reset() {
+    for (int i = 0; i < BUCKET_COUNT; ++i) buckets[i].store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    total_usec.store(0, std::memory_order_relaxed);
+}
+
+Dictionary LatencyHistogram::to_dictionary() const {
+    Dictionary d;
+    uint64_t n = get_count();
+    d["count"] = n;
+    d["mean_usec"] = n > 0 ? (double)total_usec.load(std::memory_order_relaxed) / (double)n : 0.0;
+    d["p50_usec"] = percentile(0.5);
+    d["p90_usec"] = percentile(0.9);
+    d["p99_usec"] = percentile(0.99);
+    return d;
+}
+
+std::atomic<uint64_t> SpellStats::casts{ 0 };
+std::atomic<uint64_t> SpellStats::components_executed{ 0 };
+std::atomic<uint64_t> SpellStats::synergy_hits{ 0 };
+std::atomic<int64_t> SpellStats::status_effects_live{ 0 };
+std::atomic<uint64_t> SpellStats::summons_spawned{ 0 };
+std::atomic<int64_t> SpellStats::projectiles_live{ 0 };
+LatencyHistogram SpellStats::resolve_latency;
+LatencyHistogram SpellStats::execute_latency;
+
+namespace {
+uint64_t rate_last_usec = 0;
+uint64_t rate_last_casts = 0;
+double rate_last_value = 0.0;
+
+// Monitor callables (Performance polls these from the main thread)
+double monitor_casts_per_sec() { return SpellStats::sample_casts_per_sec(); }
+double monitor_components_executed() { return (double)SpellStats::components_executed.load(std::memory_order_relaxed); }
+double monitor_synergy_hits() { return (double)SpellStats::synergy_hits.load(std::memory_order_relaxed); }
+double monitor_status_effects_live() { return (double)SpellStats::status_effects_live.load(std::memory_order_relaxed); }
+double monitor_summons_spawned() { return (double)SpellStats::summons_spawned.load(std::memory_order_relaxed); }
+double monitor_projectiles_live() { return (double)SpellStats::projectiles_live.load(std::memory_order_relaxed); }
+double monitor_resolve_p50() { return SpellStats::resolve_latency.percentile(0.5); }
+double monitor_resolve_p99() { return SpellStats::resolve_latency.percentile(0.99); }
+double monitor_execute_p50() { return SpellStats::execute_latency.percentile(0.5); }
+double monitor_execute_p99() { return SpellStats::execute_latency.percentile(0.99); }
+
+struct MonitorDef {
+    const char *id;
+    double (*fn)();
+};
+
+const MonitorDef MONITORS[] = {
+    { "spellengine/casts_per_sec", &monitor_casts_per_sec },
+    { "spellengine/components_executed", &monitor_components_executed },
+    { "spellengine/synergy_hits", &monitor_synergy_hits },
+    { "spellengine/status_effects_live", &monitor_status_effects_live },
+    { "spellengine/summons_spawned", &monitor_summons_spawned },
+    { "spellengine/projectiles_live", &monitor_projectiles_live },
+    { "spellengine/resolve_p50_usec", &monitor_resolve_p50 },
+    { "spellengine/resolve_p99_usec", &monitor_resolve_p99 },
+    { "spellengine/execute_p50_usec", &monitor_execute_p50 },
+    { "spellengine/execute_p99_usec", &monitor_execute_p99 },
+};
+} // namespace
+
+double SpellStats::sample_casts_per_sec() {
+    uint64_t now = SpellTrace::now_usec();
+    uint64_t total = casts.load(std::memory_order_relaxed);
+    if (rate_last_usec == 0) {
+        rate_last_usec = now;
+        rate_last_casts = total;
+        return 0.0;
+    }
+    // Short intervals give noisy rates; keep the previous value until 250ms have passed
+    uint64_t elapsed = now - rate_last_usec;
+    if (elapsed < 250000) return rate_last_value;
+    rate_last_value = (double)(total - rate_last_casts) * 1000000.0 / (double)elapsed;
+    rate_last_usec = now;
+    rate_last_casts = total;
+    return rate_last_value;
+}
+
+Dictionary SpellStats::get_stats() {
+    Dictionary d;
+    d["casts"] = casts.load(std::memory_order_relaxed);
+    d["casts_per_sec"] = sample_casts_per_sec();
+    d["components_executed"] = components_executed.load(std::memory_order_relaxed);
+    d["synergy_hits"] = synergy_hits.load(std::memory_order_relaxed);
+    d["status_effects_live"] = status_effects_live.load(std::memory_order_relaxed);
+    d["summons_spawned"] = summons_spawned.load(std::memory_order_relaxed);
+    d["projectiles_live"] = projectiles_live.load(std::memory_order_relaxed);
+    d["resolve_latency"] = resolve_latency.to_dictionary();
+    d["execute_latency"] = execute_latency.to_dictionary();
+    return d;
+}
+
+void SpellStats::reset() {
+    casts.store(0, std::memory_order_relaxed);
+    components_executed.store(0, std::memory_order_relaxed);
+    synergy_hits.store(0, std::memory_order_relaxed);
+    summons_spawned.store(0, std::memory_order_relaxed);
+    // status_effects_live and projectiles_live track live objects, so they are not reset
+    resolve_latency.reset();
+    execute_latency.reset();
+    rate_last_usec = 0;
+    rate_last_casts = 0;
+    rate_last_value = 0.0;
+}
+
+void SpellStats::register_monitors() {
+    Performance *perf = Performance::get_singleton();
+    if (!perf) return;
+    for (const MonitorDef &m : MONITORS) {
+        if (!perf->has_custom_monitor(m.id)) perf->add_custom_monitor(m.id, callable_mp_static(m.fn));
+    }
+}
+
+void SpellStats::unregister_monitors() {
+    Performance *perf = Performance::get_singleton();
+    if (!perf) return;
+    for (const MonitorDef &m : MONITORS) {
+        if (perf->has_custom_monitor(m.id)) perf->remove_custom_monitor(m.id);
+    }
+}
@@ -0,0 +1,180 @@
+#include "spellengine/spell_target.hpp"
+#include "spellengine/intern_table.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <algorithm>
+
+using namespace godot;
+
+std::unordered_map<uint64_t, SpellTarget *> SpellTarget::attached;
+
+SpellTarget *SpellTarget::from_object(Object *obj) {
+    if (!obj) return nullptr;
+    if (SpellTarget *st = Object::cast_to<SpellTarget>(obj)) return st;
+    if (attached.empty()) return nullptr;
+    auto it = attached.find(obj->get_instance_id());
+    return it == attached.end() ? nullptr : it->second;
+}
+
+void SpellTarget::_notification(int p_what) {
+    // spells never run in the editor, so scenes open there are left untouched
+    if (Engine::get_singleton()->is_editor_hint()) return;
+    if (p_what == NOTIFICATION_ENTER_TREE) {
+        Node *parent = get_parent();
+        if (parent && attached.emplace(parent->get_instance_id(), this).second) {
+            attached_parent_id = parent->get_instance_id();
+        }
+    } else if (p_what == NOTIFICATION_EXIT_TREE) {
+        if (attached_parent_id != 0) {
+            attached.erase(attached_parent_id);
+            attached_parent_id = 0;
+        }
+    }
+}
+
+void SpellTarget::set_max_health(double value) {
+    max_health = value;
+}
+
+double SpellTarget::get_max_health() const {
+    return max_health;
+}
+
+void SpellTarget::set_health(double value) {
+    health = value;
+    dead = health <= 0.0;
+}
+
+double SpellTarget::get_health() const {
+    return health;
+}
+
+bool SpellTarget::is_dead() const {
+    return dead;
+}
+
+void SpellTarget::set_resistances(const Dictionary &by_aspect) {
+    resistances.clear();
+    resistance_keys.clear();
+    Array keys = by_aspect.keys();
+    for (int i = 0; i < keys.size(); ++i) {
+        Variant v = by_aspect[keys[i]];
+        if (v.get_type() != Variant::INT && v.get_type() != Variant::FLOAT) continue;
+        set_resistance(keys[i], (double)v);
+    }
+}
+
+Dictionary SpellTarget::get_resistances() const {
+    Dictionary out;
+    for (size_t id = 0; id < resistances.size(); ++id) {
+        if (resistances[id] != 0.0) out[resistance_keys[id]] = resistances[id];
+    }
+    return out;
+}
+
+void SpellTarget::set_resistance(const String &aspect, double value) {
+    const int id = InternTable::aspects().intern(aspect);
+    if ((size_t)id >= resistances.size()) {
+        resistances.resize(id + 1, 0.0);
+        resistance_keys.resize(id + 1);
+    }
+    resistances[id] = value;
+    resistance_keys[id] = aspect;
+}
+
+double SpellTarget::get_resistance(const String &aspect) const {
+    const int id = InternTable::aspects().find(aspect);
+    if (id < 0 || (size_t)id >= resistances.size()) return 0.0;
+    return resistances[id];
+}
+
+double SpellTarget::apply_damage(double amount, const String &aspect, const Dictionary &meta) {
+    if (dead) return 0.0;
+    const double applied = amount * (1.0 - get_resistance(aspect));
+    health -= applied;
+    emit_signal("damaged", applied, aspect, meta, health);
+    if (health <= 0.0) {
+        dead = true;
+        emit_signal("died", meta);
+    }
+    return applied;
+}
+
+void SpellTarget::apply_damage_batch(const Array &packets) {
+    for (int i = 0; i < packets.size(); ++i) {
+        Dictionary p = packets[i];
+        apply_damage(p.get("amount", 0.0), p.get("aspect", String()), p.get("meta", Dictionary()));
+    }
+}
+
+void SpellTarget::apply_heal(double amount) {
+    if (dead) return;
+    health = std::min(max_health, health + amount);
+    emit_signal("healed", amount, health);
+}
+
+void SpellTarget::apply_knockback_meta(double force, double speed, double area, Object *caster, const Dictionary &meta) {
+    // Direction is measured from the caster (or its spatial parent) to the node this component is attached to
+    Node3D *owner_3d = Object::cast_to<Node3D>(get_parent());
+    Node3D *caster_3d = Object::cast_to<Node3D>(caster);
+    if (!caster_3d && caster) {
+        Node *caster_node = Object::cast_to<Node>(caster);
+        if (caster_node) caster_3d = Object::cast_to<Node3D>(caster_node->get_parent());
+    }
+
+    Vector3 dir(0, 1, 0);
+    if (owner_3d && caster_3d && owner_3d->is_inside_tree() && caster_3d->is_inside_tree()) {
+        Vector3 delta = owner_3d->get_global_position() - caster_3d->get_global_position();
+        if (delta.length_squared() > 1e-8) dir = delta.normalized();
+    }
+    const Vector3 impulse = dir * (real_t)force;
+    pending_knockback += impulse;
+    emit_signal("knocked_back", impulse, speed, meta);
+}
+
+void SpellTarget::apply_knockback(double force, double speed, double area, Object *caster) {
+    apply_knockback_meta(force, speed, area, caster, Dictionary());
+}
+
+Vector3 SpellTarget::get_pending_knockback() const {
+    return pending_knockback;
+}
+
+Vector3 SpellTarget::consume_knockback() {
+    Vector3 out = pending_knockback;
+    pending_knockback = Vector3();
+    return out;
+}
+
+void SpellTarget::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_max_health", "value"), &SpellTarget::set_max_health);
+    ClassDB::bind_method(D_METHOD("get_max_health"), &SpellTarget::get_max_health);
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_health"), "set_max_health", "get_max_health");
+
+    ClassDB::bind_method(D_METHOD("set_health", "value"), &SpellTarget::set_health);
+    ClassDB::bind_method(D_METHOD("get_health"), &SpellTarget::get_health);
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "health"), "set_health", "get_health");
+
+    ClassDB::bind_method(D_METHOD("set_resistances", "by_aspect"), &SpellTarget::set_resistances);
+    ClassDB::bind_method(D_METHOD("get_resistances"), &SpellTarget::get_resistances);
+    ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "resistances"), "set_resistances", "get_resistances");
+
+    ClassDB::bind_method(D_METHOD("set_resistance", "aspect", "value"), &SpellTarget::set_resistance);
+    ClassDB::bind_method(D_METHOD("get_resistance", "aspect"), &SpellTarget::get_resistance);
+    ClassDB::bind_method(D_METHOD("is_dead"), &SpellTarget::is_dead);
+
+    ClassDB::bind_method(D_METHOD("apply_damage", "amount", "aspect", "metadata"), &SpellTarget::apply_damage, DEFVAL(String()), DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("apply_damage_batch", "packets"), &SpellTarget::apply_damage_batch);
+    ClassDB::bind_method(D_METHOD("apply_heal", "amount"), &SpellTarget::apply_heal);
+    ClassDB::bind_method(D_METHOD("apply_knockback_meta", "force", "speed", "area", "caster", "metadata"), &SpellTarget::apply_knockback_meta, DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("apply_knockback", "force", "speed", "area", "caster"), &SpellTarget::apply_knockback);
+    ClassDB::bind_method(D_METHOD("get_pending_knockback"), &SpellTarget::get_pending_knockback);
+    ClassDB::bind_method(D_METHOD("consume_knockback"), &SpellTarget::consume_knockback);
+
+    ADD_SIGNAL(MethodInfo("damaged", PropertyInfo(Variant::FLOAT, "amount"), PropertyInfo(Variant::STRING, "aspect"), PropertyInfo(Variant::DICTIONARY, "metadata"), PropertyInfo(Variant::FLOAT, "health")));
+    ADD_SIGNAL(MethodInfo("died", PropertyInfo(Variant::DICTIONARY, "metadata")));
+    ADD_SIGNAL(MethodInfo("healed", PropertyInfo(Variant::FLOAT, "amount"), PropertyInfo(Variant::FLOAT, "health")));
+    ADD_SIGNAL(MethodInfo("knocked_back", PropertyInfo(Variant::VECTOR3, "impulse"), PropertyInfo(Variant::FLOAT, "speed"), PropertyInfo(Variant::DICTIONARY, "metadata")));
+}
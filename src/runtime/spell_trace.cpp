@@ -0,0 +1,109 @@
+#include "spellengine/spell_trace.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+using namespace godot;
+
+std::atomic<bool> SpellTrace::enabled{ false };
+
+namespace {
+struct TraceSlot {
+    // 0 = empty/being written, otherwise claim index + 1 (seqlock-style validation)
+    std::atomic<uint64_t> seq{ 0 };
+    const char *name = nullptr;
+    uint64_t cast_number = 0;
+    uint64_t start_usec = 0;
+    uint64_t end_usec = 0;
+    uint32_t thread_id = 0;
+    char detail[SpellTrace::DETAIL_LENGTH] = {};
+};
+
+TraceSlot *trace_slots() {
+    static TraceSlot slots[SpellTrace::RING_CAPACITY];
+    return slots;
+}
+
+std::atomic<uint64_t> trace_write_pos{ 0 };
+
+uint32_t current_thread_id() {
+    static thread_local uint32_t id = (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+    return id;
+}
+} // namespace
+
+uint64_t SpellTrace::now_usec() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SpellTrace::record(const char *name, uint64_t cast_number, const String &detail, uint64_t start_usec, uint64_t end_usec) {
+    uint64_t idx = trace_write_pos.fetch_add(1, std::memory_order_relaxed);
+    TraceSlot &slot = trace_slots()[idx % RING_CAPACITY];
+    slot.seq.store(0, std::memory_order_release);
+    slot.name = name;
+    slot.cast_number = cast_number;
+    slot.start_usec = start_usec;
+    slot.end_usec = end_usec;
+    slot.thread_id = current_thread_id();
+    CharString utf8 = detail.utf8();
+    size_t len = (size_t)utf8.length();
+    if (len >= (size_t)DETAIL_LENGTH) len = DETAIL_LENGTH - 1;
+    memcpy(slot.detail, utf8.get_data(), len);
+    slot.detail[len] = '\0';
+    slot.seq.store(idx + 1, std::memory_order_release);
+}
+
+void SpellTrace::clear() {
+    for (int i = 0; i < RING_CAPACITY; ++i) trace_slots()[i].seq.store(0, std::memory_order_release);
+}
+
+int SpellTrace::dump(const String &path) {
+    Array events;
+    TraceSlot *slots = trace_slots();
+    for (int i = 0; i < RING_CAPACITY; ++i) {
+        TraceSlot &slot = slots[i];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq == 0) continue;
+        const char *name = slot.name;
+        uint64_t cast_number = slot.cast_number;
+        uint64_t start_usec = slot.start_usec;
+        uint64_t end_usec = slot.end_usec;
+        uint32_t thread_id = slot.thread_id;
+        char detail[DETAIL_LENGTH];
+        memcpy(detail, slot.detail, DETAIL_LENGTH);
+        detail[DETAIL_LENGTH - 1] = '\0';
+        // skip slots overwritten while we were copying them
+        if (slot.seq.load(std::memory_order_acquire) != seq || !name) continue;
+
+        Dictionary args;
+        if (cast_number > 0) args["cast_id"] = String("spell_cast_") + String::num_uint64(cast_number);
+        if (detail[0] != '\0') args["detail"] = String::utf8(detail);
+
+        Dictionary ev;
+        ev["name"] = detail[0] != '\0' ? String(name) + ":" + String::utf8(detail) : String(name);
+        ev["cat"] = "spellengine";
+        ev["ph"] = "X";
+        ev["ts"] = start_usec;
+        ev["dur"] = end_usec >= start_usec ? end_usec - start_usec : 0;
+        ev["pid"] = 1;
+        ev["tid"] = thread_id;
+        ev["args"] = args;
+        events.push_back(ev);
+    }
+
+    Dictionary root;
+    root["traceEvents"] = events;
+    root["displayTimeUnit"] = "ms";
+
+    Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+    if (f.is_null()) return (int)FileAccess::get_open_error();
+    f->store_string(JSON::stringify(root));
+    return (int)OK;
+}
@@ -1,4 +1,9 @@
 #include "spellengine/status_effect.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/damage_accumulator.hpp"
+#include "spellengine/spell_target.hpp"
+#include "spellengine/target_capabilities.hpp"
+#include "spellengine/spell_stats.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/classes/timer.hpp>
@@ -6,13 +11,21 @@
 
 using namespace godot;
 
+StatusEffect::~StatusEffect() {
+    if (counted) SpellStats::status_effects_live.fetch_sub(1, std::memory_order_relaxed);
+}
+
 void StatusEffect::configure(double amount, double interval, double duration, const String &p_aspect) {
     amount_per_tick = amount;
     tick_interval = interval;
     remaining_time = duration;
     aspect = p_aspect;
+    if (!counted) {
+        counted = true;
+        SpellStats::status_effects_live.fetch_add(1, std::memory_order_relaxed);
+    }
 
-    UtilityFunctions::print(String("StatusEffect: configure amount_per_tick=") + String::num(amount_per_tick) + " interval=" + String::num(tick_interval) + " duration=" + String::num(remaining_time) + " aspect=" + aspect);
+    SPELL_DEBUG(SpellLog::CHANNEL_EXECUTOR, String("StatusEffect: configure amount_per_tick=") + String::num(amount_per_tick) + " interval=" + String::num(tick_interval) + " duration=" + String::num(remaining_time) + " aspect=" + aspect);
 
     Timer *t = memnew(Timer);
     t->set_wait_time(tick_interval);
@@ -22,6 +35,13 @@ void StatusEffect::configure(double amount, double interval, double duration, co
     t->start();
 }
 
+void StatusEffect::configure_proxy(double amount, double interval, double duration, const String &p_aspect) {
+    amount_per_tick = amount;
+    tick_interval = interval;
+    remaining_time = duration;
+    aspect = p_aspect;
+}
+
 void StatusEffect::set_metadata(const Dictionary &m) {
     metadata = m;
 }
@@ -34,13 +54,11 @@ void StatusEffect::_on_tick() {
 
     Node *parent = get_parent();
     if (parent) {
-        Variant amt = amount_per_tick;
-        Variant elem = aspect;
-        if (parent->has_method("apply_damage")) {
-            // pass metadata as third argument so targets can record tick provenance
-            parent->call("apply_damage", amt, elem, metadata);
+        if (SpellTarget::from_object(parent) || TargetCapabilities::has(parent, TargetCapabilities::APPLY_DAMAGE | TargetCapabilities::APPLY_DAMAGE_BATCH)) {
+            // metadata travels with the hit so targets can record tick provenance
+            DamageAccumulator::add_hit(parent, amount_per_tick, aspect, metadata.duplicate());
         } else {
-            UtilityFunctions::print(String("StatusEffect tick on ") + parent->get_name());
+            SPELL_TRACE(SpellLog::CHANNEL_EXECUTOR, String("StatusEffect tick on ") + parent->get_name());
         }
     }
 
@@ -50,5 +68,10 @@ void StatusEffect::_on_tick() {
 void StatusEffect::_bind_methods() {
     ClassDB::bind_method(D_METHOD("configure", "amount", "interval", "duration", "aspect"), &StatusEffect::configure);
     ClassDB::bind_method(D_METHOD("_on_tick"), &StatusEffect::_on_tick);
+    ClassDB::bind_method(D_METHOD("configure_proxy", "amount", "interval", "duration", "aspect"), &StatusEffect::configure_proxy);
     ClassDB::bind_method(D_METHOD("set_metadata", "meta"), &StatusEffect::set_metadata);
+    ClassDB::bind_method(D_METHOD("get_metadata"), &StatusEffect::get_metadata);
+    ClassDB::bind_method(D_METHOD("get_amount_per_tick"), &StatusEffect::get_amount_per_tick);
+    ClassDB::bind_method(D_METHOD("get_tick_interval"), &StatusEffect::get_tick_interval);
+    ClassDB::bind_method(D_METHOD("get_aspect"), &StatusEffect::get_aspect);
 }
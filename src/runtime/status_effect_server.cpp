@@ -0,0 +1,388 @@
+#include "spellengine/status_effect_server.hpp"
+#include "spellengine/spell_log.hpp"
+#include "spellengine/damage_accumulator.hpp"
+#include "spellengine/spell_stats.hpp"
+#include "spellengine/status_effect.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <algorithm>
+
+using namespace godot;
+
+StatusEffectServer *StatusEffectServer::singleton = nullptr;
+
+StatusEffectServer::StatusEffectServer() {
+    set_physics_process(true);
+}
+
+StatusEffectServer::~StatusEffectServer() {
+    SpellStats::status_effects_live.fetch_sub((int64_t)handles.size(), std::memory_order_relaxed);
+    if (singleton == this) singleton = nullptr;
+}
+
+StatusEffectServer *StatusEffectServer::get_singleton() {
+    if (singleton) return singleton;
+    Engine *engine = Engine::get_singleton();
+    SceneTree *tree = engine ? Object::cast_to<SceneTree>(engine->get_main_loop()) : nullptr;
+    if (!tree || !tree->get_root()) return nullptr;
+    singleton = memnew(StatusEffectServer);
+    singleton->set_name("StatusEffectServer");
+    // deferred: executors may run while the root is busy adding or removing children
+    tree->get_root()->call_deferred("add_child", singleton);
+    return singleton;
+}
+
+void StatusEffectServer::_physics_process(double delta) {
+    advance(delta);
+}
+
+StatusEffectServer::StackPolicy StatusEffectServer::stack_policy_from_string(const String &name) {
+    const String lower = name.to_lower();
+    if (lower == "refresh") return STACK_REFRESH;
+    if (lower == "additive") return STACK_ADDITIVE;
+    if (lower == "strongest") return STACK_STRONGEST;
+    return STACK_INDEPENDENT;
+}
+
+int64_t StatusEffectServer::add_effect(Node *target, double p_amount_per_tick, double p_tick_interval, double duration, const String &aspect, const Dictionary &meta) {
+    return apply_effect(target, p_amount_per_tick, p_tick_interval, duration, aspect, String(), STACK_INDEPENDENT, 0, meta);
+}
+
+int64_t StatusEffectServer::apply_effect(Node *target, double p_amount_per_tick, double p_tick_interval, double duration, const String &aspect, const String &source, int policy, int max_stacks, const Dictionary &meta) {
+    if (!target) return 0;
+    if (p_tick_interval <= 0.0) {
+        SPELL_WARN(SpellLog::CHANNEL_EXECUTOR, String("StatusEffectServer: non-positive tick interval for effect on ") + target->get_name());
+        return 0;
+    }
+    // a zero-length effect never reaches its first tick (matches StatusEffect's timer)
+    if (duration <= 0.0) {
+        SPELL_DEBUG(SpellLog::CHANNEL_EXECUTOR, String("StatusEffectServer: ignoring effect with non-positive duration on ") + target->get_name());
+        return 0;
+    }
+
+    // Collect the effects sharing this (target, aspect, source) key
+    std::vector<size_t> same_key;
+    auto te = target_effects.find(target->get_instance_id());
+    if (te != target_effects.end()) {
+        for (int64_t h : te->second) {
+            size_t i = handle_index[h];
+            if (aspects[i] == aspect && sources[i] == source) same_key.push_back(i);
+        }
+    }
+
+    switch (policy) {
+        case STACK_REFRESH:
+            if (!same_key.empty()) {
+                const size_t i = same_key[0];
+                amount_per_tick[i] = p_amount_per_tick;
+                tick_interval[i] = p_tick_interval;
+                // clamp rather than restart so re-applying faster than the interval still ticks
+                time_to_tick[i] = std::min(time_to_tick[i], p_tick_interval);
+                remaining[i] = duration;
+                metadata[i] = meta;
+                sync_proxy(i);
+                return handles[i];
+            }
+            break;
+        case STACK_ADDITIVE:
+            if (!same_key.empty()) {
+                // a refresh that also adds a stack: every stack ticks for the latest amount
+                const size_t i = same_key[0];
+                if (max_stacks <= 0 || stacks[i] < max_stacks) stacks[i] += 1;
+                amount_per_tick[i] = p_amount_per_tick;
+                tick_interval[i] = p_tick_interval;
+                time_to_tick[i] = std::min(time_to_tick[i], p_tick_interval);
+                remaining[i] = duration;
+                metadata[i] = meta;
+                sync_proxy(i);
+                return handles[i];
+            }
+            break;
+        case STACK_STRONGEST:
+            if (!same_key.empty()) {
+                const size_t i = same_key[0];
+                const double current_dps = amount_per_tick[i] * stacks[i] / tick_interval[i];
+                if (p_amount_per_tick / p_tick_interval < current_dps) return 0;
+                amount_per_tick[i] = p_amount_per_tick;
+                tick_interval[i] = p_tick_interval;
+                time_to_tick[i] = std::min(time_to_tick[i], p_tick_interval);
+                remaining[i] = duration;
+                metadata[i] = meta;
+                sync_proxy(i);
+                return handles[i];
+            }
+            break;
+        default:
+            if (max_stacks > 0 && (int)same_key.size() >= max_stacks) {
+                // evict the application closest to expiry to stay within the cap
+                size_t evict = same_key[0];
+                for (size_t i : same_key) {
+                    if (remaining[i] < remaining[evict]) evict = i;
+                }
+                remove_at(evict);
+            }
+            break;
+    }
+    return push_effect(target, p_amount_per_tick, p_tick_interval, duration, aspect, source, meta);
+}
+
+int64_t StatusEffectServer::push_effect(Node *target, double p_amount_per_tick, double p_tick_interval, double duration, const String &aspect, const String &source, const Dictionary &meta) {
+    int64_t handle = next_handle++;
+    const uint64_t target_id = target->get_instance_id();
+    handle_index[handle] = handles.size();
+    target_effects[target_id].push_back(handle);
+    handles.push_back(handle);
+    target_ids.push_back(target_id);
+    amount_per_tick.push_back(p_amount_per_tick);
+    tick_interval.push_back(p_tick_interval);
+    time_to_tick.push_back(p_tick_interval);
+    remaining.push_back(duration);
+    aspects.push_back(aspect);
+    sources.push_back(source);
+    stacks.push_back(1);
+    metadata.push_back(meta);
+
+    uint64_t proxy_id = 0;
+    if (visual_proxies_enabled) {
+        StatusEffect *proxy = memnew(StatusEffect);
+        target->add_child(proxy);
+        proxy->set_metadata(meta);
+        proxy->configure_proxy(p_amount_per_tick, p_tick_interval, duration, aspect);
+        proxy_id = proxy->get_instance_id();
+    }
+    proxy_ids.push_back(proxy_id);
+
+    SpellStats::status_effects_live.fetch_add(1, std::memory_order_relaxed);
+    SPELL_DEBUG(SpellLog::CHANNEL_EXECUTOR, String("StatusEffectServer: added effect ") + String::num_int64(handle) + " on " + target->get_name() + " amount_per_tick=" + String::num(p_amount_per_tick) + " interval=" + String::num(p_tick_interval) + " duration=" + String::num(duration));
+    return handle;
+}
+
+void StatusEffectServer::sync_proxy(size_t index) {
+    if (proxy_ids[index] == 0) return;
+    StatusEffect *proxy = Object::cast_to<StatusEffect>(ObjectDB::get_instance(proxy_ids[index]));
+    if (!proxy) return;
+    proxy->set_metadata(metadata[index]);
+    proxy->configure_proxy(amount_per_tick[index] * stacks[index], tick_interval[index], remaining[index], aspects[index]);
+}
+
+void StatusEffectServer::remove_at(size_t index) {
+    if (proxy_ids[index] != 0) {
+        Node *proxy = Object::cast_to<Node>(ObjectDB::get_instance(proxy_ids[index]));
+        if (proxy) proxy->queue_free();
+    }
+    const int64_t handle = handles[index];
+    auto te = target_effects.find(target_ids[index]);
+    if (te != target_effects.end()) {
+        std::vector<int64_t> &list = te->second;
+        list.erase(std::find(list.begin(), list.end(), handle));
+        if (list.empty()) target_effects.erase(te);
+    }
+    handle_index.erase(handle);
+
+    const size_t last = handles.size() - 1;
+    if (index != last) {
+        handles[index] = handles[last];
+        target_ids[index] = target_ids[last];
+        amount_per_tick[index] = amount_per_tick[last];
+        tick_interval[index] = tick_interval[last];
+        time_to_tick[index] = time_to_tick[last];
+        remaining[index] = remaining[last];
+        aspects[index] = aspects[last];
+        sources[index] = sources[last];
+        stacks[index] = stacks[last];
+        metadata[index] = metadata[last];
+        proxy_ids[index] = proxy_ids[last];
+        handle_index[handles[index]] = index;
+    }
+    handles.pop_back();
+    target_ids.pop_back();
+    amount_per_tick.pop_back();
+    tick_interval.pop_back();
+    time_to_tick.pop_back();
+    remaining.pop_back();
+    aspects.pop_back();
+    sources.pop_back();
+    stacks.pop_back();
+    metadata.pop_back();
+    proxy_ids.pop_back();
+    SpellStats::status_effects_live.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int StatusEffectServer::find_index(int64_t handle) const {
+    auto it = handle_index.find(handle);
+    return it == handle_index.end() ? -1 : (int)it->second;
+}
+
+bool StatusEffectServer::remove_effect(int64_t handle) {
+    int index = find_index(handle);
+    if (index < 0) return false;
+    remove_at((size_t)index);
+    return true;
+}
+
+int StatusEffectServer::remove_effects_for_target(Node *target) {
+    if (!target) return 0;
+    auto te = target_effects.find(target->get_instance_id());
+    if (te == target_effects.end()) return 0;
+    // copy: remove_at edits the per-target list
+    const std::vector<int64_t> target_handles = te->second;
+    for (int64_t h : target_handles) remove_at(handle_index[h]);
+    return (int)target_handles.size();
+}
+
+void StatusEffectServer::clear() {
+    while (!handles.empty()) remove_at(handles.size() - 1);
+}
+
+int StatusEffectServer::get_effect_count() const {
+    return (int)handles.size();
+}
+
+int StatusEffectServer::get_effect_count_for_target(Node *target) const {
+    if (!target) return 0;
+    auto te = target_effects.find(target->get_instance_id());
+    return te == target_effects.end() ? 0 : (int)te->second.size();
+}
+
+Array StatusEffectServer::get_effects_for_target(Node *target) const {
+    Array out;
+    if (!target) return out;
+    auto te = target_effects.find(target->get_instance_id());
+    if (te == target_effects.end()) return out;
+    for (int64_t h : te->second) {
+        const size_t i = handle_index.at(h);
+        Dictionary e;
+        e["handle"] = handles[i];
+        e["amount_per_tick"] = amount_per_tick[i];
+        e["tick_interval"] = tick_interval[i];
+        e["remaining"] = remaining[i];
+        e["aspect"] = aspects[i];
+        e["source"] = sources[i];
+        e["stacks"] = stacks[i];
+        e["metadata"] = metadata[i];
+        out.push_back(e);
+    }
+    return out;
+}
+
+void StatusEffectServer::advance(double delta) {
+    if (paused || delta <= 0.0) return;
+
+    // hit-stop consumes real time before any effect time passes
+    if (hit_stop_remaining > 0.0) {
+        const double stopped = std::min(hit_stop_remaining, delta);
+        hit_stop_remaining -= stopped;
+        delta -= stopped;
+    }
+    const double dt = delta * time_scale;
+    if (dt <= 0.0) return;
+
+    for (size_t i = 0; i < handles.size();) {
+        if (!ObjectDB::get_instance(target_ids[i])) {
+            remove_at(i);
+            continue;
+        }
+        time_to_tick[i] -= dt;
+        bool expired = false;
+        while (time_to_tick[i] <= 0.0) {
+            // each tick hands the target its own copy; targets may keep or edit the Dictionary
+            pending_hits.push_back(PendingHit{ target_ids[i], amount_per_tick[i] * stacks[i], aspects[i], metadata[i].duplicate() });
+            remaining[i] -= tick_interval[i];
+            time_to_tick[i] += tick_interval[i];
+            if (remaining[i] <= 0.0) {
+                expired = true;
+                break;
+            }
+        }
+        if (expired) {
+            remove_at(i);
+            continue;
+        }
+        ++i;
+    }
+
+    flush_hits();
+}
+
+void StatusEffectServer::flush_hits() {
+    if (pending_hits.empty()) return;
+    // swap out first: a target's apply_damage may add effects and tick again later this frame
+    std::vector<PendingHit> hits;
+    hits.swap(pending_hits);
+    {
+        // every tick of this pass reaches a target in one delivery
+        DamageBatchScope batch;
+        for (const PendingHit &hit : hits) {
+            Object *obj = ObjectDB::get_instance(hit.target_id);
+            if (obj) DamageAccumulator::add_hit(obj, hit.amount, hit.aspect, hit.meta);
+        }
+    }
+    hits.clear();
+    if (pending_hits.empty()) pending_hits.swap(hits);
+}
+
+void StatusEffectServer::set_paused(bool p_paused) {
+    paused = p_paused;
+}
+
+bool StatusEffectServer::is_paused() const {
+    return paused;
+}
+
+void StatusEffectServer::set_time_scale(double scale) {
+    time_scale = std::max(0.0, scale);
+}
+
+double StatusEffectServer::get_time_scale() const {
+    return time_scale;
+}
+
+void StatusEffectServer::apply_hit_stop(double seconds) {
+    hit_stop_remaining = std::max(hit_stop_remaining, seconds);
+}
+
+double StatusEffectServer::get_hit_stop_remaining() const {
+    return hit_stop_remaining;
+}
+
+void StatusEffectServer::set_visual_proxies_enabled(bool enabled) {
+    visual_proxies_enabled = enabled;
+}
+
+bool StatusEffectServer::get_visual_proxies_enabled() const {
+    return visual_proxies_enabled;
+}
+
+void StatusEffectServer::_bind_methods() {
+    ClassDB::bind_static_method("StatusEffectServer", D_METHOD("get_singleton"), &StatusEffectServer::get_singleton);
+    ClassDB::bind_method(D_METHOD("add_effect", "target", "amount_per_tick", "tick_interval", "duration", "aspect", "metadata"), &StatusEffectServer::add_effect, DEFVAL(String()), DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("apply_effect", "target", "amount_per_tick", "tick_interval", "duration", "aspect", "source", "policy", "max_stacks", "metadata"), &StatusEffectServer::apply_effect, DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("remove_effect", "handle"), &StatusEffectServer::remove_effect);
+    ClassDB::bind_method(D_METHOD("remove_effects_for_target", "target"), &StatusEffectServer::remove_effects_for_target);
+    ClassDB::bind_method(D_METHOD("clear"), &StatusEffectServer::clear);
+    ClassDB::bind_method(D_METHOD("get_effect_count"), &StatusEffectServer::get_effect_count);
+    ClassDB::bind_method(D_METHOD("get_effect_count_for_target", "target"), &StatusEffectServer::get_effect_count_for_target);
+    ClassDB::bind_method(D_METHOD("get_effects_for_target", "target"), &StatusEffectServer::get_effects_for_target);
+    ClassDB::bind_method(D_METHOD("advance", "delta"), &StatusEffectServer::advance);
+    ClassDB::bind_method(D_METHOD("set_paused", "paused"), &StatusEffectServer::set_paused);
+    ClassDB::bind_method(D_METHOD("is_paused"), &StatusEffectServer::is_paused);
+    ClassDB::bind_method(D_METHOD("set_time_scale", "scale"), &StatusEffectServer::set_time_scale);
+    ClassDB::bind_method(D_METHOD("get_time_scale"), &StatusEffectServer::get_time_scale);
+    ClassDB::bind_method(D_METHOD("apply_hit_stop", "seconds"), &StatusEffectServer::apply_hit_stop);
+    ClassDB::bind_method(D_METHOD("get_hit_stop_remaining"), &StatusEffectServer::get_hit_stop_remaining);
+    ClassDB::bind_method(D_METHOD("set_visual_proxies_enabled", "enabled"), &StatusEffectServer::set_visual_proxies_enabled);
+    ClassDB::bind_method(D_METHOD("get_visual_proxies_enabled"), &StatusEffectServer::get_visual_proxies_enabled);
+
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "paused"), "set_paused", "is_paused");
+
+    BIND_ENUM_CONSTANT(STACK_INDEPENDENT);
+    BIND_ENUM_CONSTANT(STACK_REFRESH);
+    BIND_ENUM_CONSTANT(STACK_ADDITIVE);
+    BIND_ENUM_CONSTANT(STACK_STRONGEST);
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "time_scale"), "set_time_scale", "get_time_scale");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "visual_proxies_enabled"), "set_visual_proxies_enabled", "get_visual_proxies_enabled");
+}
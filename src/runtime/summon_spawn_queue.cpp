@@ -0,0 +1,347 @@
+#include "spellengine/summon_spawn_queue.hpp"
+#include "spellengine/summon_executor.hpp"
+#include "spellengine/spell_trace.hpp"
+#include "spellengine/spell_stats.hpp"
+#include "spellengine/multimesh_batcher.hpp"
+#include "spellengine/spell_caster.hpp"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <algorithm>
+#include <limits>
+
+using namespace godot;
+
+SummonSpawnQueue *SummonSpawnQueue::singleton = nullptr;
+
+SummonSpawnQueue::SummonSpawnQueue() {
+    set_process(true);
+}
+
+SummonSpawnQueue::~SummonSpawnQueue() {
+    // builds still running write into slots owned by this queue
+    for (Group &g : groups) discard_build(g);
+    if (singleton == this) singleton = nullptr;
+}
+
+SummonSpawnQueue *SummonSpawnQueue::get_singleton() {
+    if (singleton) return singleton;
+    Engine *engine = Engine::get_singleton();
+    SceneTree *tree = engine ? Object::cast_to<SceneTree>(engine->get_main_loop()) : nullptr;
+    if (!tree || !tree->get_root()) return nullptr;
+    singleton = memnew(SummonSpawnQueue);
+    singleton->set_name("SummonSpawnQueue");
+    // deferred: executors may run while the root is busy adding or removing children
+    tree->get_root()->call_deferred("add_child", singleton);
+    return singleton;
+}
+
+void SummonSpawnQueue::_process(double delta) {
+    advance();
+}
+
+int64_t SummonSpawnQueue::enqueue(const Ref<SpellContext> &ctx, const Ref<PackedScene> &scene, ScenePool *pool, Node *parent, const Transform3D &xform, const std::vector<Vector3> &positions, bool batch_visuals) {
+    Group g;
+    g.id = next_group_id++;
+    g.ctx = ctx;
+    g.scene = scene;
+    g.pool = pool;
+    g.parent_id = parent ? parent->get_instance_id() : 0;
+    g.xform = xform;
+    g.positions = positions;
+    g.batch_visuals = batch_visuals;
+    if (ctx.is_valid()) {
+        Dictionary r = ctx->get_results();
+        Dictionary pending = r.get("spawn_groups", Dictionary());
+        pending[g.id] = (int64_t)positions.size();
+        r["spawn_groups"] = pending;
+        ctx->set_results(r);
+    }
+    groups.push_back(g);
+    return groups.back().id;
+}
+
+int64_t SummonSpawnQueue::enqueue_async(const Ref<SpellContext> &ctx, const Ref<PackedScene> &scene, Node *parent, const Transform3D &xform, const std::vector<Vector3> &positions, bool batch_visuals) {
+    WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+    if (!wtp || positions.empty()) return enqueue(ctx, scene, nullptr, parent, xform, positions, batch_visuals);
+
+    std::shared_ptr<AsyncBuild> build = std::make_shared<AsyncBuild>();
+    build->scene = scene;
+    build->built.assign(positions.size(), nullptr);
+
+    const int64_t id = enqueue(ctx, scene, nullptr, parent, xform, positions, batch_visuals);
+    Group &g = groups.back();
+    g.build_id = id;
+    {
+        std::lock_guard<std::mutex> lock(builds_mutex);
+        builds[id] = build;
+    }
+    g.task_id = wtp->add_group_task(callable_mp(this, &SummonSpawnQueue::_build_instance).bind(id), (int)positions.size(), -1, false, "SummonSpawnQueue instantiate");
+    return id;
+}
+
+std::shared_ptr<SummonSpawnQueue::AsyncBuild> SummonSpawnQueue::get_build(int64_t build_id) {
+    std::lock_guard<std::mutex> lock(builds_mutex);
+    auto it = builds.find(build_id);
+    return it == builds.end() ? nullptr : it->second;
+}
+
+void SummonSpawnQueue::_build_instance(uint32_t p_index, int64_t p_build_id) {
+    std::shared_ptr<AsyncBuild> build = get_build(p_build_id);
+    if (!build || p_index >= build->built.size()) return;
+    // Nodes outside the tree may be created from any thread; placement and physics state wait for
+    // the commit, where the parent's transform is current. Exported setters that run here
+    // (SpellCaster mana, SpellTarget resistances) intern through the thread-safe InternTable.
+    build->built[p_index] = build->scene->instantiate();
+}
+
+bool SummonSpawnQueue::is_ready(Group &g, bool block) {
+    if (g.task_id < 0) return true;
+    WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+    if (!block && !wtp->is_group_task_completed(g.task_id)) return false;
+    // also required after completion to release the task
+    wtp->wait_for_group_task_completion(g.task_id);
+    g.task_id = -1;
+    return true;
+}
+
+void SummonSpawnQueue::discard_build(Group &g) {
+    if (g.build_id == 0) return;
+    is_ready(g, true);
+    std::shared_ptr<AsyncBuild> build = get_build(g.build_id);
+    if (build) {
+        for (size_t i = g.next; i < build->built.size(); ++i) {
+            if (build->built[i]) memdelete(build->built[i]);
+            build->built[i] = nullptr;
+        }
+    }
+    std::lock_guard<std::mutex> lock(builds_mutex);
+    builds.erase(g.build_id);
+    g.build_id = 0;
+}
+
+int SummonSpawnQueue::spawn_from(Group &g, int max_count, uint64_t deadline_usec) {
+    // the parent may have been freed while the group waited
+    Node *parent = nullptr;
+    if (g.parent_id != 0) {
+        parent = Object::cast_to<Node>(ObjectDB::get_instance(g.parent_id));
+        if (!parent) {
+            discard_build(g);
+            refund(g, g.positions.size() - g.next);
+            g.next = g.positions.size();
+            return 0;
+        }
+    }
+
+    std::shared_ptr<AsyncBuild> build = g.build_id != 0 ? get_build(g.build_id) : nullptr;
+    Array batch;
+    int attempted = 0;
+    while (g.next < g.positions.size() && attempted < max_count) {
+        Node *inst = nullptr;
+        if (build) {
+            // commit an instance built by the worker task
+            inst = build->built[g.next];
+            build->built[g.next] = nullptr;
+            Transform3D it = g.xform;
+            it.origin = g.positions[g.next++];
+            if (inst) {
+                SpellStats::count(SpellStats::summons_spawned);
+                if (parent) parent->add_child(inst);
+                Node3D *n3 = Object::cast_to<Node3D>(inst);
+                if (n3) n3->set_global_transform(it);
+                SummonExecutor::make_inert(inst);
+                MultiMeshBatcher *batcher = g.batch_visuals ? MultiMeshBatcher::get_singleton() : nullptr;
+                if (batcher) batcher->track_node(inst);
+            }
+        } else {
+            Transform3D it = g.xform;
+            it.origin = g.positions[g.next++];
+            inst = SummonExecutor::spawn_instance(g.scene, g.pool, parent, it, g.batch_visuals);
+        }
+        ++attempted;
+        if (inst) batch.append(inst);
+        if (SpellTrace::now_usec() >= deadline_usec) break;
+    }
+    if (build && g.next >= g.positions.size()) discard_build(g);
+
+    g.spawned.append_array(batch);
+    if (g.ctx.is_valid()) {
+        Array targets = g.ctx->get_targets();
+        targets.append_array(batch);
+        g.ctx->set_targets(targets);
+        Dictionary r = g.ctx->get_results();
+        Array spawned = r.get("spawned_instances", Array());
+        spawned.append_array(batch);
+        r["spawned_instances"] = spawned;
+        if (batch.size() > 0) r["last_spawned"] = batch[batch.size() - 1];
+        Dictionary pending = r.get("spawn_groups", Dictionary());
+        pending[g.id] = (int64_t)(g.positions.size() - g.next);
+        r["spawn_groups"] = pending;
+        g.ctx->set_results(r);
+    }
+    return attempted;
+}
+
+void SummonSpawnQueue::finish(Group &g) {
+    if (g.ctx.is_valid()) {
+        Dictionary r = g.ctx->get_results();
+        Dictionary pending = r.get("spawn_groups", Dictionary());
+        pending.erase(g.id);
+        r["spawn_groups"] = pending;
+        g.ctx->set_results(r);
+    }
+    emit_signal("group_spawned", g.id, g.spawned);
+
+    if (!g.ctx.is_valid() || waiters.empty() || has_group_for(g.ctx)) return;
+    // take the context's waiters out first: a callback may queue further summons and wait again
+    std::vector<Callable> ready;
+    for (size_t i = 0; i < waiters.size();) {
+        if (waiters[i].ctx != g.ctx) {
+            ++i;
+            continue;
+        }
+        ready.push_back(waiters[i].callback);
+        waiters[i] = waiters.back();
+        waiters.pop_back();
+    }
+    for (const Callable &cb : ready) {
+        if (cb.is_valid()) cb.call();
+    }
+}
+
+void SummonSpawnQueue::refund(Group &g, size_t cancelled) {
+    const size_t n = std::min(cancelled, g.refundable);
+    if (n == 0 || g.refund_caster_id == 0) return;
+    g.refundable -= n;
+    SpellCaster *sc = Object::cast_to<SpellCaster>(ObjectDB::get_instance(g.refund_caster_id));
+    if (!sc) return;
+    Array aspects = g.refund_per_instance.keys();
+    for (int i = 0; i < aspects.size(); ++i) {
+        sc->add_mana(aspects[i], (double)g.refund_per_instance[aspects[i]] * (double)n);
+    }
+}
+
+bool SummonSpawnQueue::has_group_for(const Ref<SpellContext> &ctx) const {
+    for (const Group &g : groups) {
+        if (g.ctx == ctx) return true;
+    }
+    return false;
+}
+
+void SummonSpawnQueue::set_group_refund(int64_t group_id, Node *caster, const Dictionary &mana_per_instance, int max_instances) {
+    for (Group &g : groups) {
+        if (g.id != group_id) continue;
+        g.refund_caster_id = caster ? caster->get_instance_id() : 0;
+        g.refund_per_instance = mana_per_instance;
+        g.refundable = max_instances > 0 ? (size_t)max_instances : 0;
+        return;
+    }
+}
+
+void SummonSpawnQueue::call_when_spawned(const Ref<SpellContext> &ctx, const Callable &callback) {
+    if (!ctx.is_valid() || !has_group_for(ctx)) {
+        callback.call();
+        return;
+    }
+    waiters.push_back(Waiter{ ctx, callback });
+}
+
+void SummonSpawnQueue::advance() {
+    const uint64_t start = SpellTrace::now_usec();
+    const uint64_t deadline = usec_per_frame > 0 ? start + (uint64_t)usec_per_frame : std::numeric_limits<uint64_t>::max();
+    int budget = instances_per_frame > 0 ? instances_per_frame : std::numeric_limits<int>::max();
+    // the first instance of the frame is always spawned so a tight budget still makes progress
+    bool first = true;
+    size_t gi = 0;
+    while (gi < groups.size() && budget > 0 && (first || SpellTrace::now_usec() < deadline)) {
+        Group &g = groups[gi];
+        // async groups still building are skipped, later groups may go ahead
+        if (!is_ready(g, false)) {
+            ++gi;
+            continue;
+        }
+        first = false;
+        budget -= spawn_from(g, budget, deadline);
+        if (g.next < g.positions.size()) continue;
+        // remove before emitting so handlers can enqueue or cancel safely
+        Group done = g;
+        groups.erase(groups.begin() + gi);
+        finish(done);
+    }
+}
+
+void SummonSpawnQueue::flush() {
+    while (!groups.empty()) {
+        Group &g = groups.front();
+        is_ready(g, true);
+        spawn_from(g, std::numeric_limits<int>::max(), std::numeric_limits<uint64_t>::max());
+        Group done = g;
+        groups.pop_front();
+        finish(done);
+    }
+}
+
+bool SummonSpawnQueue::cancel_group(int64_t group_id) {
+    for (auto it = groups.begin(); it != groups.end(); ++it) {
+        if (it->id != group_id) continue;
+        discard_build(*it);
+        Group done = *it;
+        refund(done, done.positions.size() - done.next);
+        done.next = done.positions.size();
+        groups.erase(it);
+        finish(done);
+        return true;
+    }
+    return false;
+}
+
+int SummonSpawnQueue::get_pending_count() const {
+    size_t pending = 0;
+    for (const Group &g : groups) pending += g.positions.size() - g.next;
+    return (int)pending;
+}
+
+int SummonSpawnQueue::get_group_count() const {
+    return (int)groups.size();
+}
+
+void SummonSpawnQueue::set_instances_per_frame(int count) {
+    instances_per_frame = count;
+}
+
+int SummonSpawnQueue::get_instances_per_frame() const {
+    return instances_per_frame;
+}
+
+void SummonSpawnQueue::set_usec_per_frame(int64_t usec) {
+    usec_per_frame = usec;
+}
+
+int64_t SummonSpawnQueue::get_usec_per_frame() const {
+    return usec_per_frame;
+}
+
+void SummonSpawnQueue::_bind_methods() {
+    ClassDB::bind_static_method("SummonSpawnQueue", D_METHOD("get_singleton"), &SummonSpawnQueue::get_singleton);
+    ClassDB::bind_method(D_METHOD("advance"), &SummonSpawnQueue::advance);
+    ClassDB::bind_method(D_METHOD("flush"), &SummonSpawnQueue::flush);
+    ClassDB::bind_method(D_METHOD("cancel_group", "group_id"), &SummonSpawnQueue::cancel_group);
+    ClassDB::bind_method(D_METHOD("set_group_refund", "group_id", "caster", "mana_per_instance", "max_instances"), &SummonSpawnQueue::set_group_refund);
+    ClassDB::bind_method(D_METHOD("call_when_spawned", "ctx", "callback"), &SummonSpawnQueue::call_when_spawned);
+    ClassDB::bind_method(D_METHOD("get_pending_count"), &SummonSpawnQueue::get_pending_count);
+    ClassDB::bind_method(D_METHOD("get_group_count"), &SummonSpawnQueue::get_group_count);
+    ClassDB::bind_method(D_METHOD("set_instances_per_frame", "count"), &SummonSpawnQueue::set_instances_per_frame);
+    ClassDB::bind_method(D_METHOD("get_instances_per_frame"), &SummonSpawnQueue::get_instances_per_frame);
+    ClassDB::bind_method(D_METHOD("set_usec_per_frame", "usec"), &SummonSpawnQueue::set_usec_per_frame);
+    ClassDB::bind_method(D_METHOD("get_usec_per_frame"), &SummonSpawnQueue::get_usec_per_frame);
+
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "instances_per_frame"), "set_instances_per_frame", "get_instances_per_frame");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "usec_per_frame"), "set_usec_per_frame", "get_usec_per_frame");
+
+    ADD_SIGNAL(MethodInfo("group_spawned", PropertyInfo(Variant::INT, "group_id"), PropertyInfo(Variant::ARRAY, "instances")));
+}
@@ -0,0 +1,71 @@
+#include "spellengine/target_capabilities.hpp"
+
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <algorithm>
+
+using namespace godot;
+
+// Smallest cache size at which freed targets are swept
+static constexpr size_t MIN_SWEEP_SIZE = 256;
+
+std::unordered_map<uint64_t, TargetCapabilities::Entry> TargetCapabilities::by_instance;
+size_t TargetCapabilities::sweep_at = MIN_SWEEP_SIZE;
+
+uint32_t TargetCapabilities::probe(Object *obj) {
+    static const StringName apply_damage("apply_damage");
+    static const StringName apply_damage_batch("apply_damage_batch");
+    static const StringName apply_knockback("apply_knockback");
+    static const StringName apply_knockback_meta("apply_knockback_meta");
+    static const StringName record_spell_event("record_spell_event");
+    static const StringName apply_heal("apply_heal");
+
+    uint32_t flags = 0;
+    if (obj->has_method(apply_damage)) flags |= APPLY_DAMAGE;
+    if (obj->has_method(apply_damage_batch)) flags |= APPLY_DAMAGE_BATCH;
+    if (obj->has_method(apply_knockback)) flags |= APPLY_KNOCKBACK;
+    if (obj->has_method(apply_knockback_meta)) flags |= APPLY_KNOCKBACK_META;
+    if (obj->has_method(record_spell_event)) flags |= RECORD_SPELL_EVENT;
+    if (obj->has_method(apply_heal)) flags |= APPLY_HEAL;
+    return flags;
+}
+
+uint32_t TargetCapabilities::get(Object *obj) {
+    if (!obj) return 0;
+    const uint64_t id = obj->get_instance_id();
+    auto it = by_instance.find(id);
+    if (it != by_instance.end()) {
+        if (!it->second.valid) {
+            it->second.flags = probe(obj);
+            it->second.valid = true;
+        }
+        return it->second.flags;
+    }
+    if (by_instance.size() >= sweep_at) sweep();
+    Entry e;
+    e.flags = probe(obj);
+    by_instance[id] = e;
+    // the connection outlives clear(), so a target seen again may already have it
+    static const StringName script_changed("script_changed");
+    const Callable forget = callable_mp_static(&TargetCapabilities::_forget).bind(id);
+    if (!obj->is_connected(script_changed, forget)) obj->connect(script_changed, forget);
+    return e.flags;
+}
+
+void TargetCapabilities::_forget(uint64_t instance_id) {
+    auto it = by_instance.find(instance_id);
+    if (it != by_instance.end()) it->second.valid = false;
+}
+
+void TargetCapabilities::sweep() {
+    for (auto it = by_instance.begin(); it != by_instance.end();) {
+        if (ObjectDB::get_instance(it->first)) ++it;
+        else it = by_instance.erase(it);
+    }
+    sweep_at = std::max<size_t>(MIN_SWEEP_SIZE, by_instance.size() * 2);
+}
+
+void TargetCapabilities::clear() {
+    by_instance.clear();
+    sweep_at = MIN_SWEEP_SIZE;
+}
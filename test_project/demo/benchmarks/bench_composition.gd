@@ -0,0 +1,169 @@
+extends Node
+
+# Composition throughput benchmark. Generates synthetic aspects, components and synergies
+# in memory and times the composition entry points with the no-op executor, so only the
+# engine's own work is measured. Run headless from the repository root:
+#
+#   godot --headless --path test_project res://demo/benchmarks/bench_composition.tscn -- --out=res://bench_composition.json
+#
+# Options (after "--"): --out=<path> (default user://bench_composition.json),
+# --quick (smaller grid, for smoke runs), --no-cache (disable the resolution cache).
+
+const ASPECT_COUNTS = [1, 4, 16, 64]
+const COMPONENT_COUNTS = [1, 16, 64, 256]
+const QUICK_ASPECT_COUNTS = [1, 8]
+const QUICK_COMPONENT_COUNTS = [1, 32]
+# Each measurement runs REPEATS batches; a batch performs roughly OPS_PER_BATCH component-level operations
+const REPEATS = 5
+const OPS_PER_BATCH = 20000
+# Synthetic pair synergies stay within the first few aspects to keep the registry's bitmask index in range
+const SYNERGY_ASPECTS = 8
+
+var _registered_synergies: Array = []
+
+func _ready():
+	var opts = _parse_args()
+	var engine = SpellEngine.new()
+	engine.set_resolution_cache_enabled(not opts.no_cache)
+
+	var aspect_counts = QUICK_ASPECT_COUNTS if opts.quick else ASPECT_COUNTS
+	var component_counts = QUICK_COMPONENT_COUNTS if opts.quick else COMPONENT_COUNTS
+	var results = []
+	for n_aspects in aspect_counts:
+		for n_components in component_counts:
+			results += _run_size(engine, n_aspects, n_components)
+	_unregister_synergies()
+
+	var report = {
+		"suite": "composition",
+		"engine_version": Engine.get_version_info(),
+		"timestamp": Time.get_datetime_string_from_system(true),
+		"resolution_cache": engine.get_resolution_cache_enabled(),
+		"repeats": REPEATS,
+		"results": results,
+	}
+	var f = FileAccess.open(opts.out, FileAccess.WRITE)
+	if f:
+		f.store_string(JSON.stringify(report, "\t"))
+		f.close()
+		print("[bench] wrote ", results.size(), " results to ", ProjectSettings.globalize_path(opts.out))
+	else:
+		push_error("[bench] could not open " + opts.out)
+	get_tree().quit(0 if f else 1)
+
+func _parse_args() -> Dictionary:
+	var opts = {"out": "user://bench_composition.json", "quick": false, "no_cache": false}
+	for arg in OS.get_cmdline_user_args():
+		if arg.begins_with("--out="):
+			opts.out = arg.substr(6)
+		elif arg == "--quick":
+			opts.quick = true
+		elif arg == "--no-cache":
+			opts.no_cache = true
+	return opts
+
+func _aspect_name(i:int) -> String:
+	return "bench_a%d" % i
+
+# Builds n_aspects aspects sharing n_components components round-robin; each component
+# contributes to its own aspect and the next one so synergy lookups see multi-aspect sets.
+func _make_aspects(n_aspects:int, n_components:int) -> Array:
+	var per_aspect = []
+	for i in range(n_aspects):
+		per_aspect.append([])
+	for c in range(n_components):
+		var a = c % n_aspects
+		var contribs = {_aspect_name(a): 0.5, _aspect_name((a + 1) % n_aspects): 0.5}
+		var comp = SpellComponent.new()
+		comp.set_executor_id("noop")
+		comp.set_cost(1.0 + float(c % 7))
+		comp.set_base_params({"amount": 10.0 + c, "duration": 2.0, "radius": 1.5})
+		comp.set_aspects_contributions(contribs)
+		per_aspect[a].append(comp)
+	var aspects = []
+	for i in range(n_aspects):
+		var aspect = Aspect.new()
+		aspect.set_name(_aspect_name(i))
+		aspect.set_components(per_aspect[i])
+		aspects.append(aspect)
+	return aspects
+
+func _register_synergies(n_aspects:int):
+	var reg = SynergyRegistry.get_singleton()
+	for i in range(min(n_aspects, SYNERGY_ASPECTS)):
+		var a = _aspect_name(i)
+		var b = _aspect_name((i + 1) % n_aspects)
+		var key = a + "+" + b if a != b else a
+		if reg.has_synergy(key):
+			continue
+		reg.register_synergy(key, {"component_aspects": [a, b] if a != b else [a], "default_scalers": {"amount": 1.1, "mana_cost": 0.95}})
+		_registered_synergies.append(key)
+
+func _unregister_synergies():
+	var reg = SynergyRegistry.get_singleton()
+	for key in _registered_synergies:
+		reg.unregister_synergy(key)
+	_registered_synergies.clear()
+
+func _make_context(n_aspects:int) -> SpellContext:
+	var caster = SpellCaster.new()
+	var assigned = []
+	for i in range(n_aspects):
+		caster.set_mana(_aspect_name(i), 1.0e15)
+		assigned.append(_aspect_name(i))
+	caster.set_assigned_aspects(assigned)
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	return ctx
+
+func _run_size(engine:SpellEngine, n_aspects:int, n_components:int) -> Array:
+	_register_synergies(n_aspects)
+	var aspects = _make_aspects(n_aspects, n_components)
+	var ctx = _make_context(n_aspects)
+	var caster = ctx.get_caster()
+	var spell = engine.build_spell_from_aspects(aspects)
+	var comps = spell.get_components()
+	var casting_aspects = caster.get_assigned_aspects()
+	var iterations = max(1, OPS_PER_BATCH / n_components)
+
+	var out = []
+	out.append(_measure("build_spell_from_aspects", n_aspects, n_components, iterations, func():
+		for i in range(iterations):
+			engine.build_spell_from_aspects(aspects)
+	))
+	out.append(_measure("resolve_component_params", n_aspects, n_components, iterations, func():
+		for i in range(iterations):
+			for comp in comps:
+				engine.resolve_component_params(comp, casting_aspects, caster, {})
+	))
+	out.append(_measure("get_adjusted_mana_costs", n_aspects, n_components, iterations, func():
+		for i in range(iterations):
+			engine.get_adjusted_mana_costs(spell, ctx)
+	))
+	out.append(_measure("execute_spell", n_aspects, n_components, iterations, func():
+		for i in range(iterations):
+			engine.execute_spell(spell, ctx)
+	))
+	caster.free()
+	return out
+
+# Runs body REPEATS times (after one warm-up) and reports per-spell timings in microseconds.
+func _measure(op:String, n_aspects:int, n_components:int, iterations:int, body:Callable) -> Dictionary:
+	body.call()
+	var samples = []
+	for r in range(REPEATS):
+		var t0 = Time.get_ticks_usec()
+		body.call()
+		samples.append(float(Time.get_ticks_usec() - t0) / iterations)
+	samples.sort()
+	var res = {
+		"op": op,
+		"aspects": n_aspects,
+		"components": n_components,
+		"iterations": iterations,
+		"usec_per_spell_min": samples[0],
+		"usec_per_spell_median": samples[samples.size() / 2],
+		"usec_per_component_median": samples[samples.size() / 2] / n_components,
+	}
+	print("[bench] %-26s aspects=%3d components=%4d  %10.2f us/spell" % [op, n_aspects, n_components, res.usec_per_spell_median])
+	return res
@@ -0,0 +1,244 @@
+extends Node3D
+
+# Executor throughput stress benchmark. Spawns N targets shaped like DemoTarget.gd and M casters,
+# casts damage/dot/knockback/force/summon spells at a fixed rate and samples frame time,
+# physics time, node count, memory and live StatusEffect count every frame. Run headless:
+#
+#   godot --headless --path test_project res://demo/benchmarks/bench_executors.tscn -- --targets=2000 --rate=500 --out=res://bench_executors.json
+#
+# Options (after "--"):
+#   --targets=N            target nodes (default 1000)
+#   --casters=M            casters cycled through round-robin (default 16)
+#   --rate=R               casts per second across all casters (default 240)
+#   --targets-per-cast=K   targets hit by each cast (default 32)
+#   --duration=S           measured seconds after warm-up (default 10)
+#   --warmup=S             unmeasured seconds before sampling (default 1)
+#   --executors=a,b        subset of damage,dot,knockback,force,summon (default all)
+#   --summon-lifetime=S    seconds before spawned summons are freed (default 2)
+#   --out=<path>           JSON output (default user://bench_executors.json)
+
+const BenchTarget = preload("res://demo/benchmarks/bench_target.gd")
+const SUMMON_SCENE = "res://demo/scenes/projectile.tscn"
+const ALL_EXECUTORS = ["damage", "dot", "knockback", "force", "summon"]
+
+var opts: Dictionary
+var engine := SpellEngine.new()
+var targets: Array = []
+var casters: Array = []
+var spells: Dictionary = {}
+var executor_order: Array = []
+
+var _cast_budget := 0.0
+var _cast_index := 0
+var _target_cursor := 0
+var _casts_by_executor: Dictionary = {}
+var _elapsed := 0.0
+var _measuring := false
+# [spawn_time, node] pairs, oldest first
+var _live_summons: Array = []
+
+var _frame_usec: Array = []
+var _process_msec: Array = []
+var _physics_msec: Array = []
+var _timeline: Array = []
+var _second_acc := {"frames": 0, "frame_usec": 0.0, "max_frame_usec": 0.0}
+var _peak_nodes := 0
+var _peak_memory := 0
+var _peak_status_effects := 0
+var _last_frame_ticks := 0
+
+func _ready():
+	opts = _parse_args()
+	Engine.max_fps = 0
+	for exec_name in opts.executors:
+		if ALL_EXECUTORS.has(exec_name):
+			executor_order.append(exec_name)
+			_casts_by_executor[exec_name] = 0
+	_spawn_targets(opts.targets)
+	_spawn_casters(opts.casters)
+	_build_spells()
+	engine.reset_stats()
+	_last_frame_ticks = Time.get_ticks_usec()
+	print("[bench] targets=%d casters=%d rate=%d/s executors=%s" % [opts.targets, opts.casters, opts.rate, ",".join(executor_order)])
+
+func _parse_args() -> Dictionary:
+	var o = {
+		"targets": 1000, "casters": 16, "rate": 240.0, "targets_per_cast": 32,
+		"duration": 10.0, "warmup": 1.0, "executors": ALL_EXECUTORS.duplicate(),
+		"summon_lifetime": 2.0, "out": "user://bench_executors.json",
+	}
+	for arg in OS.get_cmdline_user_args():
+		var parts = arg.trim_prefix("--").split("=", true, 1)
+		if parts.size() != 2:
+			continue
+		var key = parts[0].replace("-", "_")
+		match key:
+			"targets", "casters", "targets_per_cast":
+				o[key] = int(parts[1])
+			"rate", "duration", "warmup", "summon_lifetime":
+				o[key] = float(parts[1])
+			"executors":
+				o.executors = Array(parts[1].split(",", false))
+			"out":
+				o.out = parts[1]
+	return o
+
+func _spawn_targets(n:int):
+	var side = int(ceil(sqrt(float(n))))
+	for i in range(n):
+		var t = RigidBody3D.new()
+		t.set_script(BenchTarget)
+		t.name = "Target%d" % i
+		t.gravity_scale = 0.0
+		t.position = Vector3((i % side) * 2.0, 0.0, (i / side) * 2.0)
+		add_child(t)
+		targets.append(t)
+
+func _spawn_casters(m:int):
+	for i in range(m):
+		var holder = Node3D.new()
+		holder.name = "CasterBody%d" % i
+		holder.position = Vector3(-5.0, 1.0, i * 2.0)
+		add_child(holder)
+		var caster = SpellCaster.new()
+		caster.name = "Caster"
+		caster.set_assigned_aspects(["fire"])
+		caster.set_mana("fire", 1.0e15)
+		holder.add_child(caster)
+		casters.append(caster)
+
+func _make_spell(executor_id:String, params:Dictionary) -> Spell:
+	var comp = SpellComponent.new()
+	comp.set_executor_id(executor_id)
+	comp.set_cost(0.0)
+	comp.set_base_params(params)
+	var spell = Spell.new()
+	spell.set_components([comp])
+	return spell
+
+func _build_spells():
+	spells["damage"] = _make_spell("damage_v1", {"amount": 1.0, "aspect": "fire"})
+	spells["dot"] = _make_spell("dot_v1", {"amount_per_tick": 0.5, "tick_interval": 0.25, "duration": 2.0, "aspect": "fire"})
+	spells["knockback"] = _make_spell("knockback_v1", {"force": 10.0, "speed": 5.0, "area": 3.0})
+	spells["force"] = _make_spell("force_v1", {"force": Vector3(0, 0.5, 0)})
+	spells["summon"] = _make_spell("summon_scene_v1", {"scene_path": SUMMON_SCENE, "position_from_caster": true, "pattern_type": "circular", "pattern_count": 4, "pattern_radius": 1.5})
+
+func _next_targets() -> Array:
+	var out = []
+	var k = min(opts.targets_per_cast, targets.size())
+	for i in range(k):
+		out.append(targets[(_target_cursor + i) % targets.size()])
+	_target_cursor = (_target_cursor + k) % max(1, targets.size())
+	return out
+
+func _cast_one():
+	if executor_order.is_empty():
+		return
+	var exec_name = executor_order[_cast_index % executor_order.size()]
+	var caster = casters[_cast_index % casters.size()]
+	_cast_index += 1
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	if exec_name != "summon":
+		ctx.set_targets(_next_targets())
+	engine.execute_spell(spells[exec_name], ctx)
+	_casts_by_executor[exec_name] += 1
+	if exec_name == "summon":
+		var now = _elapsed
+		for inst in ctx.get_results().get("spawned_instances", []):
+			_live_summons.append([now, inst])
+
+func _expire_summons():
+	while not _live_summons.is_empty() and _elapsed - _live_summons[0][0] >= opts.summon_lifetime:
+		var inst = _live_summons.pop_front()[1]
+		if is_instance_valid(inst):
+			inst.queue_free()
+
+func _process(delta):
+	var now_ticks = Time.get_ticks_usec()
+	var frame_usec = float(now_ticks - _last_frame_ticks)
+	_last_frame_ticks = now_ticks
+	_elapsed += delta
+
+	_cast_budget += delta * opts.rate
+	while _cast_budget >= 1.0:
+		_cast_budget -= 1.0
+		_cast_one()
+	_expire_summons()
+
+	if not _measuring:
+		if _elapsed >= opts.warmup:
+			_measuring = true
+			_elapsed = 0.0
+			engine.reset_stats()
+		return
+	_sample(frame_usec)
+	if _elapsed >= opts.duration:
+		_finish()
+
+func _sample(frame_usec:float):
+	_frame_usec.append(frame_usec)
+	_process_msec.append(Performance.get_monitor(Performance.TIME_PROCESS) * 1000.0)
+	_physics_msec.append(Performance.get_monitor(Performance.TIME_PHYSICS_PROCESS) * 1000.0)
+	_peak_nodes = max(_peak_nodes, int(Performance.get_monitor(Performance.OBJECT_NODE_COUNT)))
+	_peak_memory = max(_peak_memory, int(Performance.get_monitor(Performance.MEMORY_STATIC)))
+	var stats = engine.get_stats()
+	_peak_status_effects = max(_peak_status_effects, int(stats["status_effects_live"]))
+
+	_second_acc.frames += 1
+	_second_acc.frame_usec += frame_usec
+	_second_acc.max_frame_usec = max(_second_acc.max_frame_usec, frame_usec)
+	if _elapsed >= _timeline.size() + 1:
+		_timeline.append({
+			"t": _timeline.size() + 1,
+			"frames": _second_acc.frames,
+			"mean_frame_usec": _second_acc.frame_usec / max(1, _second_acc.frames),
+			"max_frame_usec": _second_acc.max_frame_usec,
+			"node_count": int(Performance.get_monitor(Performance.OBJECT_NODE_COUNT)),
+			"memory_static": int(Performance.get_monitor(Performance.MEMORY_STATIC)),
+			"status_effects_live": int(stats["status_effects_live"]),
+		})
+		_second_acc = {"frames": 0, "frame_usec": 0.0, "max_frame_usec": 0.0}
+
+func _percentiles(samples:Array) -> Dictionary:
+	if samples.is_empty():
+		return {}
+	var s = samples.duplicate()
+	s.sort()
+	var total = 0.0
+	for v in s:
+		total += v
+	return {
+		"mean": total / s.size(),
+		"p50": s[int(s.size() * 0.5)],
+		"p95": s[min(s.size() - 1, int(s.size() * 0.95))],
+		"p99": s[min(s.size() - 1, int(s.size() * 0.99))],
+		"max": s[s.size() - 1],
+	}
+
+func _finish():
+	set_process(false)
+	var report = {
+		"suite": "executors",
+		"engine_version": Engine.get_version_info(),
+		"timestamp": Time.get_datetime_string_from_system(true),
+		"config": opts,
+		"frames": _frame_usec.size(),
+		"casts_by_executor": _casts_by_executor,
+		"frame_usec": _percentiles(_frame_usec),
+		"process_msec": _percentiles(_process_msec),
+		"physics_msec": _percentiles(_physics_msec),
+		"peak_node_count": _peak_nodes,
+		"peak_memory_static": _peak_memory,
+		"peak_status_effects_live": _peak_status_effects,
+		"spell_stats": engine.get_stats(),
+		"timeline": _timeline,
+	}
+	var f = FileAccess.open(opts.out, FileAccess.WRITE)
+	if f:
+		f.store_string(JSON.stringify(report, "\t"))
+		f.close()
+		print("[bench] %d frames, frame p99=%.0f us, peak nodes=%d -> %s" % [_frame_usec.size(), report.frame_usec.get("p99", 0.0), _peak_nodes, ProjectSettings.globalize_path(opts.out)])
+	else:
+		push_error("[bench] could not open " + opts.out)
+	get_tree().quit(0 if f else 1)
@@ -0,0 +1,31 @@
+extends RigidBody3D
+
+# Benchmark target with the same executor-facing surface as DemoTarget.gd
+# (apply_damage / apply_damage_batch / apply_knockback / apply_knockback_meta / apply_heal / record_spell_event)
+# but without printing or per-event logs, so the measured cost is the executors' own.
+
+var health := 100.0
+var damage_events := 0
+var knockback_events := 0
+var total_damage := 0.0
+
+func apply_damage(amount, aspect, metadata = null):
+	health -= float(amount)
+	total_damage += float(amount)
+	damage_events += 1
+
+func apply_damage_batch(packets):
+	for p in packets:
+		apply_damage(p["amount"], p["aspect"], p["meta"])
+
+func apply_knockback(force, speed, area, caster):
+	knockback_events += 1
+
+func apply_knockback_meta(force, speed, area, caster, metadata = null):
+	knockback_events += 1
+
+func apply_heal(amount):
+	health += float(amount)
+
+func record_spell_event(metadata):
+	pass
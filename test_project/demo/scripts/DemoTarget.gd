@@ -90,6 +90,11 @@ func apply_damage(amount, aspect, metadata = null):
 	# Print the new event as its own line prefixed by the spell cast id so logs are easier to scan
 	# print("[DemoTarget] spell_cast=%s +event: %s" % [cast_id, str(ev)])
 
+# Coalesced delivery from the engine: one call per target with the hits in arrival order
+func apply_damage_batch(packets):
+	for p in packets:
+		apply_damage(p["amount"], p["aspect"], p["meta"])
+
 func apply_knockback(force, speed, area, caster):
 	print("[DemoTarget] %s knocked back by force %s speed %s with area %s from %s" % [name, force, speed, area, caster.name if caster else "<none>"])
 
@@ -79,6 +79,11 @@ func _ready():
 	# wire up demo UI if present
 	_setup_ui()
 
+	# impact spells of native projectiles run on this engine, with its merge modes and cache settings
+	var projectiles = ProjectileServer.get_singleton()
+	if projectiles:
+		projectiles.set_impact_engine(engine)
+
 	# Try to auto-wire caster if not already set (allow controller to work even without DemoUi)
 	if not caster or not is_instance_valid(caster):
 		var root = get_tree().current_scene if get_tree().current_scene else get_tree().get_root()
@@ -1,6 +1,7 @@
 extends RigidBody3D
 
 # Simple fireball behavior: apply direction as initial velocity and auto-free after lifetime
+# (returned to the ScenePool instead when spawned with use_pool)
 @export var speed: float = 20.0
 @export var lifetime: float = 5.0
 
@@ -15,7 +16,13 @@ func _ready():
 func _physics_process(delta: float) -> void:
 	_life_timer += delta
 	if _life_timer >= lifetime:
-		queue_free()
+		_life_timer = 0.0
+		if not ScenePool.get_singleton().release(self):
+			queue_free()
+
+# Called by ScenePool when a released instance is handed out again
+func on_pool_acquire() -> void:
+	_life_timer = 0.0
 
 func apply_force_custom(force: Vector3) -> void:
 	# Apply a central impulse to the rigid body so physics handles motion.
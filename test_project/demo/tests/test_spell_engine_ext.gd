@@ -115,6 +115,954 @@ func no_contribs_uses_first_aspect(engine:SpellEngine) -> Dictionary:
 	else:
 		return {"ok": false, "expected": expected, "got": total}
 
+func compiled_plan_reused(engine:SpellEngine) -> Dictionary:
+	# compile_spell caches the plan on the Spell until its components change
+	var spell = _make_spell_with_component(5.0, {"fire": 1.0})
+	var plan_a = engine.compile_spell(spell)
+	var plan_b = engine.compile_spell(spell)
+	if plan_a != plan_b or plan_a.get_step_count() != 1:
+		return {"ok": false, "reason": "plan not reused", "steps": plan_a.get_step_count()}
+	var comp = SpellComponent.new()
+	comp.set_executor_id("choose_vector")
+	spell.set_components([spell.get_components()[0], comp])
+	var plan_c = engine.compile_spell(spell)
+	if plan_c == plan_a or plan_c.get_step_count() != 2 or plan_c.get_first_control_index() != 1:
+		return {"ok": false, "reason": "plan not rebuilt", "steps": plan_c.get_step_count(), "first_control": plan_c.get_first_control_index()}
+	return {"ok": true}
+
+func resolution_cache_invalidation(engine:SpellEngine) -> Dictionary:
+	# repeat queries hit the cache; changing a caster scaler invalidates it
+	engine.set_default_merge_mode("mana_cost", 2) # multiply
+	var spell = _make_spell_with_component(10.0, {"fire": 1.0})
+	var ctx = SpellContext.new()
+	var caster = SpellCaster.new()
+	caster.set_scaler("fire", "mana_cost", 1.2)
+	ctx.set_caster(caster)
+	engine.get_adjusted_mana_costs(spell, ctx)
+	var first = engine.get_adjusted_mana_costs(spell, ctx).get("total_mana", 0.0)
+	var stats = engine.get_resolution_cache_stats()
+	if stats.get("hits", 0) < 1:
+		return {"ok": false, "reason": "no cache hit", "stats": stats}
+	caster.set_scaler("fire", "mana_cost", 2.0)
+	var second = engine.get_adjusted_mana_costs(spell, ctx).get("total_mana", 0.0)
+	var expected_first = 10.0 * (1.2 * 1.3)
+	var expected_second = 10.0 * (2.0 * 1.3)
+	caster.free()
+	if approx_equal(first, expected_first, 1e-4) and approx_equal(second, expected_second, 1e-4):
+		return {"ok": true}
+	return {"ok": false, "expected": [expected_first, expected_second], "got": [first, second]}
+
+func resolution_cache_evicts_lru(engine:SpellEngine) -> Dictionary:
+	# a full cache drops only the least recently used entry
+	engine.set_resolution_cache_capacity(2)
+	var comps = []
+	for i in range(3):
+		var c = SpellComponent.new()
+		c.set_base_params({"damage": float(i)})
+		comps.append(c)
+	engine.resolve_component_params(comps[0], [])
+	engine.resolve_component_params(comps[1], [])
+	engine.resolve_component_params(comps[0], []) # hit, comps[0] becomes most recent
+	engine.resolve_component_params(comps[2], []) # evicts comps[1]
+	var before = engine.get_resolution_cache_stats()
+	engine.resolve_component_params(comps[0], [])
+	var after = engine.get_resolution_cache_stats()
+	if before.get("entries", 0) != 2:
+		return {"ok": false, "reason": "capacity not respected", "stats": before}
+	if after.get("hits", 0) != before.get("hits", 0) + 1:
+		return {"ok": false, "reason": "recently used entry evicted", "before": before, "after": after}
+	engine.resolve_component_params(comps[1], [])
+	var last = engine.get_resolution_cache_stats()
+	if last.get("misses", 0) != after.get("misses", 0) + 1:
+		return {"ok": false, "reason": "lru entry kept", "stats": last}
+	return {"ok": true}
+
+func batch_cast_statuses(engine:SpellEngine) -> Dictionary:
+	# a free component casts OK, a missing context reports invalid args,
+	# and a costed component without mana reports insufficient mana
+	var free_spell = _make_spell_with_component(0.0, {})
+	var costly_spell = _make_spell_with_component(10.0, {"fire": 1.0})
+	var broke_caster = SpellCaster.new()
+	var broke_ctx = SpellContext.new()
+	broke_ctx.set_caster(broke_caster)
+	var casts = [
+		{"spell": free_spell, "context": SpellContext.new()},
+		[free_spell, null],
+		{"spell": costly_spell, "context": broke_ctx},
+	]
+	var statuses = engine.execute_spells_batch(casts)
+	broke_caster.free()
+	var expected = PackedInt32Array([0, 1, 2])
+	if statuses == expected:
+		return {"ok": true}
+	return {"ok": false, "expected": expected, "got": statuses}
+
+func parallel_mana_costs_match(engine:SpellEngine) -> Dictionary:
+	# the parallel planner path must agree with get_adjusted_mana_costs
+	engine.set_default_merge_mode("mana_cost", 2) # multiply
+	var caster = SpellCaster.new()
+	caster.set_scaler("fire", "mana_cost", 1.2)
+	var casts = []
+	var expected = []
+	for i in range(12):
+		var spell = _make_spell_with_component(5.0 + i, {"fire": 0.6, "wind": 0.4})
+		var ctx = SpellContext.new()
+		ctx.set_caster(caster)
+		casts.append({"spell": spell, "context": ctx})
+		expected.append(engine.get_adjusted_mana_costs(spell, ctx).get("total_mana", 0.0))
+	var got = engine.get_adjusted_mana_costs_parallel(casts)
+	caster.free()
+	for i in range(casts.size()):
+		if not approx_equal(got[i].get("total_mana", -1.0), expected[i], 1e-6):
+			return {"ok": false, "index": i, "expected": expected[i], "got": got[i]}
+	return {"ok": true}
+
+
+func caster_storage_roundtrip(engine:SpellEngine) -> Dictionary:
+	# dense caster storage must round-trip through the Dictionary properties
+	var caster = SpellCaster.new()
+	caster.set_aspect_mana({"fire": 5.0, "water": 0})
+	caster.set_aspect_scalers({"fire": {"damage": 1.5, "mana_cost": 2}})
+	caster.add_mana("fire", 1.0)
+	var ok = approx_equal(caster.get_mana("fire"), 6.0, 1e-9)
+	ok = ok and caster.get_aspect_mana().has("water") and caster.get_mana("unknown") == 0.0
+	ok = ok and approx_equal(caster.get_scaler("fire", "damage"), 1.5, 1e-9)
+	ok = ok and caster.get_scaler("fire", "radius") == 1.0 and caster.get_scaler("wind", "damage") == 1.0
+	ok = ok and not caster.deduct_mana("water", 1.0) and caster.deduct_mana("fire", 6.0)
+	# aspect ids are case-insensitive, matching SynergyRegistry
+	caster.set_mana("Wind", 3.0)
+	ok = ok and approx_equal(caster.get_mana("wind"), 3.0, 1e-9) and caster.can_deduct("WIND", 3.0)
+	var scalers = caster.get_aspect_scalers()
+	caster.free()
+	if ok and scalers.get("fire", {}).get("mana_cost", 0.0) == 2.0:
+		return {"ok": true}
+	return {"ok": false, "got": scalers}
+
+func aspect_keys_keep_authored_spelling(engine:SpellEngine) -> Dictionary:
+	# ids fold case, but saved Dictionaries must come back with the keys they were authored with
+	var caster = SpellCaster.new()
+	caster.set_aspect_mana({"Fire": 50})
+	caster.set_aspect_scalers({"Fire": {"damage": 2.0}})
+	var mana = caster.get_aspect_mana()
+	var scalers = caster.get_aspect_scalers()
+	var lookup_ok = caster.get_mana("fire") == 50.0 and caster.get_scaler("FIRE", "damage") == 2.0
+	caster.free()
+	var target = SpellTarget.new()
+	target.set_resistances({"Fire": 0.5})
+	var res = target.get_resistances()
+	lookup_ok = lookup_ok and target.get_resistance("fire") == 0.5
+	target.free()
+	if lookup_ok and mana.keys() == ["Fire"] and scalers.keys() == ["Fire"] and res.keys() == ["Fire"]:
+		return {"ok": true}
+	return {"ok": false, "mana": mana, "scalers": scalers, "resistances": res}
+
+func synergy_ids_ignore_unrelated_aspects(engine:SpellEngine) -> Dictionary:
+	# aspect names interned elsewhere must not use up the registry's 64 synergy bits
+	var caster = SpellCaster.new()
+	for i in range(80):
+		caster.set_mana("noise_%d" % i, 1.0)
+	caster.free()
+	var reg = SynergyRegistry.get_singleton()
+	reg.register_synergy("omega+zeta", {"component_aspects": ["zeta", "omega"]})
+	var id = reg.get_aspect_id("Zeta")
+	var key = reg.get_synergy_key_for_aspects(["Zeta", "omega"])
+	var noise_id = reg.get_aspect_id("noise_0")
+	reg.unregister_synergy("omega+zeta")
+	if id >= 0 and id < 64 and key == "omega+zeta" and noise_id == -1:
+		return {"ok": true}
+	return {"ok": false, "id": id, "key": key, "noise_id": noise_id}
+
+func _synergy_lookups(reg) -> Array:
+	return [
+		reg.get_synergy_key_for_aspects(["water", "Fire"]),
+		reg.get_synergy_key_for_aspects(["MUD", "earth"]),
+		reg.get_synergy_key_for_aspects(["fire", "earth"]),
+	]
+
+func synergy_overflow_matches_index(engine:SpellEngine) -> Dictionary:
+	# the overflow fallback must resolve the same synergies as the bitmask index:
+	# component_aspects without an alias key, and mixed-case "+" keys
+	var reg = SynergyRegistry.get_singleton()
+	reg.register_synergy("steam", {"component_aspects": ["fire", "water"]})
+	reg.register_synergy("Earth+Mud", {"default_scalers": {"damage": 1.1}})
+	var indexed = _synergy_lookups(reg)
+	reg.unregister_synergy("steam")
+	reg.unregister_synergy("Earth+Mud")
+	var fillers = []
+	for i in range(70):
+		var k = "filler_%d" % i
+		fillers.append(k)
+		reg.register_synergy(k, {"default_scalers": {"damage": 1.0}})
+	reg.register_synergy("steam", {"component_aspects": ["fire", "water"]})
+	reg.register_synergy("Earth+Mud", {"default_scalers": {"damage": 1.1}})
+	var overflowed = _synergy_lookups(reg)
+	reg.unregister_synergy("steam")
+	reg.unregister_synergy("Earth+Mud")
+	for k in fillers:
+		reg.unregister_synergy(k)
+	if indexed == ["fire+water", "earth+mud", ""] and overflowed == indexed:
+		return {"ok": true}
+	return {"ok": false, "indexed": indexed, "overflowed": overflowed}
+
+func native_params_reach_executor(engine:SpellEngine) -> Dictionary:
+	# damage_v1 reads its params natively; an int amount must arrive intact on both the
+	# uncached and the cached resolution path, with a fresh cast_id each time
+	var caster = SpellCaster.new()
+	caster.set_mana("earth", 100.0)
+	add_child(caster)
+	var target = preload("res://demo/scripts/DemoTarget.gd").new()
+	add_child(target)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("damage_v1")
+	comp.set_cost(1.0)
+	comp.set_base_params({"amount": 7})
+	comp.set_aspects_contributions({"earth": 1})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	for i in range(2):
+		var ctx = SpellContext.new()
+		ctx.set_caster(caster)
+		ctx.set_targets([target])
+		engine.execute_spell(spell, ctx)
+	var casts = target.spell_casts
+	caster.queue_free()
+	target.queue_free()
+	if casts.size() != 2:
+		return {"ok": false, "expected_casts": 2, "got": casts.keys()}
+	for cid in casts.keys():
+		if not approx_equal(casts[cid]["total"], 7.0, 1e-6):
+			return {"ok": false, "cast_id": cid, "got": casts[cid]["total"]}
+	return {"ok": true}
+
+func executor_schemas_generated(engine:SpellEngine) -> Dictionary:
+	# schemas are generated from the typed params declarations
+	var summon = SummonExecutor.new().get_param_schema()
+	var dot = DotExecutor.new().get_param_schema()
+	var checks = [
+		summon.get("pattern_count", {}).get("type") == "int",
+		summon.get("pattern_count", {}).get("default") == 1,
+		summon.get("scale", {}).get("default") == [1.0, 1.0, 1.0],
+		summon.get("scene", {}).get("type") == "object",
+		dot.get("tick_interval", {}).get("default") == 1.0,
+		dot.get("aspect", {}).get("type") == "string",
+	]
+	if not checks.has(false):
+		return {"ok": true}
+	return {"ok": false, "checks": checks, "summon": summon, "dot": dot}
+
+func log_channels_filter_and_buffer(engine:SpellEngine) -> Dictionary:
+	# warnings land in the ring buffer; lowering the channel level filters them out
+	var comp = SpellComponent.new()
+	comp.set_executor_id("no_such_executor")
+	var spell = Spell.new()
+	spell.set_components([comp])
+	SpellLog.set_echo(false)
+	SpellLog.clear_entries()
+	engine.execute_spell(spell, SpellContext.new())
+	var warned = SpellLog.get_entries()
+	SpellLog.set_channel_level(SpellLog.CHANNEL_ENGINE, SpellLog.LEVEL_ERROR)
+	SpellLog.clear_entries()
+	engine.execute_spell(spell, SpellContext.new())
+	var filtered = SpellLog.get_entries()
+	SpellLog.set_channel_level(SpellLog.CHANNEL_ENGINE, SpellLog.LEVEL_WARN)
+	SpellLog.set_echo(true)
+	if warned.size() == 1 and warned[0]["level"] == SpellLog.LEVEL_WARN and filtered.is_empty():
+		return {"ok": true}
+	return {"ok": false, "warned": warned, "filtered": filtered}
+
+func trace_dump_has_cast_spans(engine:SpellEngine) -> Dictionary:
+	# a traced cast exports cast/resolve/execute spans tagged with its cast id
+	var spell = _make_spell_with_component(0.0, {})
+	spell.get_components()[0].set_executor_id("damage_v1")
+	engine.clear_trace()
+	engine.set_trace_enabled(true)
+	engine.execute_spell(spell, SpellContext.new())
+	engine.set_trace_enabled(false)
+	var path = "user://spell_trace_test.json"
+	if engine.dump_trace(path) != OK:
+		return {"ok": false, "reason": "dump failed"}
+	var parsed = JSON.parse_string(FileAccess.get_file_as_string(path))
+	var names = {}
+	var cast_ids = {}
+	for ev in parsed.get("traceEvents", []):
+		names[ev["name"].split(":")[0]] = true
+		cast_ids[ev["args"].get("cast_id", "")] = true
+	if names.has("cast") and names.has("resolve") and names.has("execute") and cast_ids.size() == 1:
+		return {"ok": true}
+	return {"ok": false, "names": names.keys(), "cast_ids": cast_ids.keys()}
+
+func stats_count_casts(engine:SpellEngine) -> Dictionary:
+	# each cast bumps the cast/component counters and records resolve/execute latencies
+	var spell = _make_spell_with_component(0.0, {})
+	spell.get_components()[0].set_executor_id("damage_v1")
+	engine.reset_stats()
+	for i in range(3):
+		engine.execute_spell(spell, SpellContext.new())
+	var stats = engine.get_stats()
+	if stats["casts"] == 3 and stats["components_executed"] == 3 and stats["resolve_latency"]["count"] == 3 and stats["execute_latency"]["count"] == 3:
+		if Performance.has_custom_monitor("spellengine/casts_per_sec"):
+			return {"ok": true}
+		return {"ok": false, "reason": "monitor not registered"}
+	return {"ok": false, "stats": stats}
+
+func status_effect_server_ticks(engine:SpellEngine) -> Dictionary:
+	# server-driven DoT honours hit-stop and time scale and expires after its last tick
+	var server = StatusEffectServer.get_singleton()
+	var t = preload("res://demo/scripts/DemoTarget.gd").new()
+	t.name = "ServerDotTarget"
+	add_child(t)
+	server.add_effect(t, 2.0, 0.5, 1.5, "fire", {})
+	# a zero-duration effect is rejected and never ticks
+	var zero_handle = server.add_effect(t, 50.0, 0.1, 0.0, "fire", {})
+	server.advance(0.4)
+	var before_tick = t.health
+	server.apply_hit_stop(0.5)
+	server.advance(0.5)
+	var after_hit_stop = t.health
+	server.set_time_scale(2.0)
+	server.advance(0.05)
+	var after_first_tick = t.health
+	server.set_time_scale(1.0)
+	server.advance(1.0)
+	var remaining = server.get_effect_count_for_target(t)
+	var final_health = t.health
+	t.queue_free()
+	if zero_handle == 0 and before_tick == 100.0 and after_hit_stop == 100.0 and after_first_tick == 98.0 and final_health == 94.0 and remaining == 0:
+		return {"ok": true}
+	return {"ok": false, "health": [before_tick, after_hit_stop, after_first_tick, final_health], "remaining": remaining, "zero_handle": zero_handle}
+
+func dot_stack_policies(engine:SpellEngine) -> Dictionary:
+	# re-applications on one (target, aspect, source) merge according to the stack policy
+	var server = StatusEffectServer.get_singleton()
+	var t = Node.new()
+	add_child(t)
+	for i in range(5):
+		server.apply_effect(t, 1.0, 1.0, 3.0, "fire", "additive_src", StatusEffectServer.STACK_ADDITIVE, 3)
+	for i in range(4):
+		server.apply_effect(t, 1.0, 1.0, 3.0, "fire", "refresh_src", StatusEffectServer.STACK_REFRESH, 0)
+	server.apply_effect(t, 1.0, 1.0, 3.0, "fire", "strong_src", StatusEffectServer.STACK_STRONGEST, 0)
+	var weaker = server.apply_effect(t, 0.5, 1.0, 3.0, "fire", "strong_src", StatusEffectServer.STACK_STRONGEST, 0)
+	server.apply_effect(t, 2.0, 1.0, 3.0, "fire", "strong_src", StatusEffectServer.STACK_STRONGEST, 0)
+	for i in range(3):
+		server.apply_effect(t, 1.0, 1.0, 3.0 + i, "fire", "indep_src", StatusEffectServer.STACK_INDEPENDENT, 2)
+	var by_source = {}
+	for e in server.get_effects_for_target(t):
+		by_source[e["source"]] = by_source.get(e["source"], []) + [e]
+	var removed = server.remove_effects_for_target(t)
+	t.queue_free()
+	var checks = [
+		by_source.get("additive_src", []).size() == 1 and by_source["additive_src"][0]["stacks"] == 3,
+		by_source.get("refresh_src", []).size() == 1,
+		weaker == 0 and by_source.get("strong_src", []).size() == 1 and by_source["strong_src"][0]["amount_per_tick"] == 2.0,
+		by_source.get("indep_src", []).size() == 2,
+		removed == 5,
+	]
+	if not checks.has(false):
+		return {"ok": true}
+	return {"ok": false, "checks": checks}
+
+func _stack_timing_target(label:String):
+	var t = preload("res://demo/scripts/DemoTarget.gd").new()
+	t.name = "StackTiming_" + label
+	add_child(t)
+	return t
+
+func dot_stack_tick_timing(engine:SpellEngine) -> Dictionary:
+	# merged applications keep the tick cadence unless the new interval is shorter, additive
+	# stacks tick for the latest amount, and visual proxies follow the merged values
+	var server = StatusEffectServer.get_singleton()
+	server.set_visual_proxies_enabled(true)
+	var refresh = _stack_timing_target("refresh")
+	var additive = _stack_timing_target("additive")
+	var strongest = _stack_timing_target("strongest")
+	var independent = _stack_timing_target("independent")
+	server.apply_effect(refresh, 1.0, 1.0, 3.0, "fire", "t", StatusEffectServer.STACK_REFRESH, 0)
+	server.apply_effect(additive, 1.0, 1.0, 3.0, "fire", "t", StatusEffectServer.STACK_ADDITIVE, 0)
+	server.apply_effect(strongest, 1.0, 1.0, 3.0, "fire", "t", StatusEffectServer.STACK_STRONGEST, 0)
+	server.apply_effect(independent, 1.0, 1.0, 3.0, "fire", "t", StatusEffectServer.STACK_INDEPENDENT, 0)
+	server.advance(0.2)
+	# next ticks are 0.8s away; the refresh/strongest re-applications shorten that to 0.5s
+	server.apply_effect(refresh, 2.0, 0.5, 3.0, "fire", "t", StatusEffectServer.STACK_REFRESH, 0)
+	server.apply_effect(additive, 2.0, 1.0, 3.0, "fire", "t", StatusEffectServer.STACK_ADDITIVE, 0)
+	server.apply_effect(strongest, 3.0, 0.5, 3.0, "fire", "t", StatusEffectServer.STACK_STRONGEST, 0)
+	server.apply_effect(independent, 1.0, 1.0, 3.0, "fire", "t", StatusEffectServer.STACK_INDEPENDENT, 0)
+	server.advance(0.5)
+	var at_half = [refresh.health, additive.health, strongest.health, independent.health]
+	server.advance(0.3)
+	var at_first = [refresh.health, additive.health, strongest.health, independent.health]
+	server.advance(0.2)
+	var independent_second = independent.health
+	var proxy_amount = -1.0
+	for c in refresh.get_children():
+		if c is StatusEffect:
+			proxy_amount = c.get_amount_per_tick()
+	var additive_proxy = -1.0
+	for c in additive.get_children():
+		if c is StatusEffect:
+			additive_proxy = c.get_amount_per_tick()
+	for t in [refresh, additive, strongest, independent]:
+		server.remove_effects_for_target(t)
+		t.queue_free()
+	server.set_visual_proxies_enabled(false)
+	var checks = [
+		at_half == [98.0, 100.0, 97.0, 100.0],
+		# refresh next ticks at 1.2s, additive deals 2 stacks x 2.0, the first independent ticks
+		at_first == [98.0, 96.0, 97.0, 99.0],
+		independent_second == 98.0,
+		proxy_amount == 2.0 and additive_proxy == 4.0,
+	]
+	if not checks.has(false):
+		return {"ok": true}
+	return {"ok": false, "checks": checks, "at_half": at_half, "at_first": at_first, "proxies": [proxy_amount, additive_proxy]}
+
+func damage_batched_per_target(engine:SpellEngine) -> Dictionary:
+	# hits from every cast in a batch reach a batch-capable target in one ordered call
+	var script = GDScript.new()
+	script.source_code = "extends Node\nvar calls = []\nfunc apply_damage_batch(packets):\n\tcalls.append(packets)\n"
+	script.reload()
+	var target = Node.new()
+	target.set_script(script)
+	add_child(target)
+	var casts = []
+	for amount in [1.0, 2.0, 3.0]:
+		var comp = SpellComponent.new()
+		comp.set_executor_id("damage_v1")
+		comp.set_base_params({"amount": amount})
+		var spell = Spell.new()
+		spell.set_components([comp])
+		var ctx = SpellContext.new()
+		ctx.set_targets([target])
+		casts.append([spell, ctx])
+	engine.execute_spells_batch(casts)
+	var calls = target.calls
+	target.queue_free()
+	if calls.size() == 1 and calls[0].size() == 3 and calls[0][0]["amount"] == 1.0 and calls[0][2]["amount"] == 3.0 and calls[0][1]["meta"].has("cast_id"):
+		return {"ok": true}
+	return {"ok": false, "calls": calls}
+
+func target_capabilities_follow_script(engine:SpellEngine) -> Dictionary:
+	# swapping a target's script re-probes its cached capabilities, changing what it receives
+	var plain = GDScript.new()
+	plain.source_code = "extends Node\nvar hits = 0\n"
+	plain.reload()
+	var damageable = GDScript.new()
+	damageable.source_code = "extends Node\nvar hits = 0\nfunc apply_damage(amount, aspect, meta = null):\n\thits += 1\n"
+	damageable.reload()
+	var target = Node.new()
+	target.set_script(plain)
+	add_child(target)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("damage_v1")
+	comp.set_base_params({"amount": 1.0})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_targets([target])
+	SpellLog.set_echo(false)
+	engine.execute_spell(spell, ctx)
+	SpellLog.set_echo(true)
+	target.set_script(damageable)
+	engine.execute_spell(spell, ctx)
+	var hits = target.hits
+	target.queue_free()
+	if hits == 1:
+		return {"ok": true}
+	return {"ok": false, "hits": hits}
+
+func spell_target_native_hits(engine:SpellEngine) -> Dictionary:
+	# a SpellTarget attached under an enemy receives damage (after resistance) and knockback natively
+	var enemy = Node3D.new()
+	add_child(enemy)
+	var st = SpellTarget.new()
+	st.set_resistance("fire", 0.5)
+	enemy.add_child(st)
+	var damaged = []
+	st.damaged.connect(func(amount, aspect, meta, health): damaged.append(amount))
+	var dmg = SpellComponent.new()
+	dmg.set_executor_id("damage_v1")
+	dmg.set_base_params({"amount": 10.0, "aspect": "fire"})
+	var kb = SpellComponent.new()
+	kb.set_executor_id("knockback_v1")
+	kb.set_base_params({"force": 4.0})
+	var spell = Spell.new()
+	spell.set_components([dmg, kb])
+	var ctx = SpellContext.new()
+	ctx.set_targets([enemy])
+	engine.execute_spell(spell, ctx)
+	var health = st.get_health()
+	var knock = st.consume_knockback()
+	enemy.queue_free()
+	if approx_equal(health, 95.0, 1e-6) and damaged == [5.0] and approx_equal(knock.length(), 4.0, 1e-4):
+		return {"ok": true}
+	return {"ok": false, "health": health, "damaged": damaged, "knockback": knock}
+
+func damage_batch_orders_all_targets(engine:SpellEngine) -> Dictionary:
+	# inside a damage batch, native SpellTargets wait for the flush like script targets
+	var enemy = Node3D.new()
+	add_child(enemy)
+	var st = SpellTarget.new()
+	enemy.add_child(st)
+	var scripted = preload("res://demo/scripts/DemoTarget.gd").new()
+	add_child(scripted)
+	var order = []
+	st.damaged.connect(func(amount, aspect, meta, health): order.append("native"))
+	var comp = SpellComponent.new()
+	comp.set_executor_id("damage_v1")
+	comp.set_base_params({"amount": 10.0, "aspect": "fire"})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_targets([scripted, enemy])
+	engine.begin_damage_batch()
+	engine.execute_spell(spell, ctx)
+	var during = [st.get_health(), scripted.health]
+	engine.end_damage_batch()
+	var after = [st.get_health(), scripted.health]
+	enemy.queue_free()
+	scripted.queue_free()
+	if during == [100.0, 100.0] and after == [90.0, 90.0] and order == ["native"]:
+		return {"ok": true}
+	return {"ok": false, "during": during, "after": after}
+
+func scene_pool_reuses_instances(engine:SpellEngine) -> Dictionary:
+	# a released instance is handed back on the next acquire with its spell state reset
+	var proto = Node3D.new()
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.free()
+	var pool = ScenePool.get_singleton()
+	pool.configure(scene, 2, 2)
+	var warm = pool.get_free_count(scene)
+	var a = pool.acquire(scene)
+	add_child(a)
+	a.position = Vector3(3, 0, 0)
+	var released = pool.release(a)
+	var b = pool.acquire(scene)
+	var stray = Node.new()
+	var ok = warm == 2 and released and b == a and b.get_parent() == null \
+		and b.position == Vector3.ZERO \
+		and not pool.release(stray)
+	pool.clear()
+	stray.free()
+	b.free()
+	if ok:
+		return {"ok": true}
+	return {"ok": false, "warm": warm, "released": released, "same": b == a}
+
+func scene_cache_preloads_summon_scene(engine:SpellEngine) -> Dictionary:
+	# a registered component's scene_path is preloaded; later lookups are cache hits on one resource
+	var path = "res://demo/scenes/projectile.tscn"
+	var comp = SpellComponent.new()
+	comp.set_executor_id("summon_scene_v1")
+	comp.set_base_params({"scene_path": path})
+	SpellComponentRegistry.get_singleton().register_component("test_scene_cache_summon", comp)
+	var cache = SceneCache.get_singleton()
+	var before = cache.get_stats()
+	var first = cache.get_scene(path)
+	var second = cache.get_scene(path)
+	var after = cache.get_stats()
+	SpellComponentRegistry.get_singleton().unregister_component("test_scene_cache_summon")
+	if first != null and first == second and cache.is_cached(path) and int(after["hits"]) > int(before["hits"]):
+		return {"ok": true}
+	return {"ok": false, "before": before, "after": after}
+
+func summon_time_sliced_spawns(engine:SpellEngine) -> Dictionary:
+	# a time-sliced summon spawns within the per-frame budget and reports completion
+	var queue = SummonSpawnQueue.get_singleton()
+	var old_budget = queue.get_instances_per_frame()
+	queue.set_instances_per_frame(2)
+	var proto = Node3D.new()
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.free()
+	var caster = Node3D.new()
+	add_child(caster)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("summon_scene_v1")
+	comp.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 5, "time_sliced": true})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	var completed = []
+	var on_done = func(group_id, instances): completed.append(instances.size())
+	queue.group_spawned.connect(on_done)
+	engine.execute_spell(spell, ctx)
+	var queued = ctx.get_results().get("spawned_instances", []).size()
+	queue.advance()
+	var first_slice = ctx.get_results().get("spawned_instances", []).size()
+	queue.flush()
+	queue.group_spawned.disconnect(on_done)
+	queue.set_instances_per_frame(old_budget)
+	var spawned = ctx.get_results().get("spawned_instances", [])
+	var pending = ctx.get_results().get("spawn_groups", {})
+	for inst in spawned:
+		inst.queue_free()
+	caster.queue_free()
+	if queued == 0 and first_slice == 2 and spawned.size() == 5 and completed == [5] and pending.is_empty():
+		return {"ok": true}
+	return {"ok": false, "queued": queued, "first_slice": first_slice, "spawned": spawned.size(), "completed": completed}
+
+func summon_async_instantiate(engine:SpellEngine) -> Dictionary:
+	# async summons are built off the main thread and only enter the tree when the queue commits them
+	var queue = SummonSpawnQueue.get_singleton()
+	var proto = Node3D.new()
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.free()
+	var caster = Node3D.new()
+	add_child(caster)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("summon_scene_v1")
+	comp.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 4, "pattern_spacing": 2.0, "async_instantiate": true})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	engine.execute_spell(spell, ctx)
+	var queued = ctx.get_results().get("spawned_instances", []).size()
+	queue.flush()
+	var spawned = ctx.get_results().get("spawned_instances", [])
+	var ok = queued == 0 and spawned.size() == 4
+	for i in range(spawned.size()):
+		var inst = spawned[i]
+		ok = ok and inst.is_inside_tree() and engine.is_spell_inert(inst) \
+			and approx_equal(inst.global_position.x, 2.0 * i, 1e-4)
+		inst.queue_free()
+	caster.queue_free()
+	if ok:
+		return {"ok": true}
+	return {"ok": false, "queued": queued, "spawned": spawned.size()}
+
+func cast_during_async_target_build(engine:SpellEngine) -> Dictionary:
+	# SpellTarget/SpellCaster setters intern aspect names on worker threads while the main
+	# thread keeps casting (and interning) new aspects; both sides must see consistent ids
+	var queue = SummonSpawnQueue.get_singleton()
+	var proto = Node3D.new()
+	var st = SpellTarget.new()
+	var res = {}
+	for i in range(32):
+		res["Async_Res_%d" % i] = 0.01 * (i + 1)
+	st.set_resistances(res)
+	proto.add_child(st)
+	st.owner = proto
+	var sc = SpellCaster.new()
+	sc.set_aspect_mana({"Async_Mana": 7.0})
+	proto.add_child(sc)
+	sc.owner = proto
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.free()
+	var caster = Node3D.new()
+	add_child(caster)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("summon_scene_v1")
+	comp.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 16, "pattern_spacing": 1.0, "async_instantiate": true})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	engine.execute_spell(spell, ctx)
+	var target = SpellTarget.new()
+	var holder = Node.new()
+	add_child(holder)
+	holder.add_child(target)
+	for i in range(200):
+		var hit = SpellComponent.new()
+		hit.set_executor_id("damage_v1")
+		hit.set_aspects_contributions({"async_main_%d" % i: 1.0})
+		hit.set_base_params({"amount": 0.0, "aspect": "async_main_%d" % i})
+		var hit_spell = Spell.new()
+		hit_spell.set_components([hit])
+		var hit_ctx = SpellContext.new()
+		hit_ctx.set_targets([holder])
+		engine.execute_spell(hit_spell, hit_ctx)
+		target.set_resistance("Async_Main_%d" % i, 0.5)
+	queue.flush()
+	var spawned = ctx.get_results().get("spawned_instances", [])
+	var ok = spawned.size() == 16
+	for inst in spawned:
+		var inst_target = inst.get_child(0)
+		var inst_caster = inst.get_child(1)
+		for i in range(32):
+			ok = ok and approx_equal(inst_target.get_resistance("async_res_%d" % i), 0.01 * (i + 1), 1e-9)
+		ok = ok and inst_caster.get_mana("async_mana") == 7.0 and inst_caster.get_aspect_mana().has("Async_Mana")
+		inst.queue_free()
+	for i in range(200):
+		ok = ok and target.get_resistance("async_main_%d" % i) == 0.5
+	holder.queue_free()
+	caster.queue_free()
+	if ok:
+		return {"ok": true}
+	return {"ok": false, "spawned": spawned.size()}
+
+func projectile_server_integrates(engine:SpellEngine) -> Dictionary:
+	# projectile_v1 launches native projectiles that integrate ballistically and expire
+	var server = ProjectileServer.get_singleton()
+	server.clear()
+	var comp = SpellComponent.new()
+	comp.set_executor_id("projectile_v1")
+	comp.set_base_params({"position_from_caster": false, "position": Vector3.ZERO, "direction": Vector3(1, 0, 0), "speed": 10.0, "count": 3, "gravity": Vector3(0, -10, 0), "lifetime": 0.75, "collision_mask": 0})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	engine.execute_spell(spell, ctx)
+	var handles = ctx.get_results().get("projectiles", [])
+	var expired = []
+	var on_expired = func(handle): expired.append(handle)
+	server.projectile_expired.connect(on_expired)
+	server.advance(0.5)
+	var pos = server.get_position(handles[0]) if handles.size() > 0 else Vector3.ZERO
+	server.advance(0.5)
+	server.projectile_expired.disconnect(on_expired)
+	var live = server.get_count()
+	if handles.size() == 3 and pos.is_equal_approx(Vector3(5, -2.5, 0)) and expired.size() == 3 and live == 0:
+		return {"ok": true}
+	return {"ok": false, "handles": handles, "pos": pos, "expired": expired, "live": live}
+
+func projectile_launches_from_caster_body(engine:SpellEngine) -> Dictionary:
+	# a SpellCaster under a body launches from the body's position (plus offset, inside the body)
+	# and the body is excluded from the sweep
+	var server = ProjectileServer.get_singleton()
+	server.clear()
+	var body = StaticBody3D.new()
+	var shape = CollisionShape3D.new()
+	shape.shape = SphereShape3D.new()
+	body.add_child(shape)
+	body.position = Vector3(5, 0, 0)
+	var caster = SpellCaster.new()
+	body.add_child(caster)
+	add_child(body)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("projectile_v1")
+	comp.set_base_params({"offset": Vector3(0, 0.1, 0), "direction": Vector3(1, 0, 0), "speed": 1.0, "gravity": Vector3.ZERO, "radius": 0.25, "lifetime": 1.0})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	engine.execute_spell(spell, ctx)
+	var handles = ctx.get_results().get("projectiles", [])
+	var origin = server.get_position(handles[0]) if handles.size() > 0 else Vector3.ZERO
+	var hits = []
+	var on_hit = func(handle, collider, position, normal): hits.append(collider)
+	server.projectile_hit.connect(on_hit)
+	server.advance(0.1)
+	server.projectile_hit.disconnect(on_hit)
+	var alive = handles.size() > 0 and server.has_projectile(handles[0])
+	server.clear()
+	body.queue_free()
+	if origin.is_equal_approx(Vector3(5, 0.1, 0)) and hits.is_empty() and alive:
+		return {"ok": true}
+	return {"ok": false, "origin": origin, "hits": hits, "alive": alive}
+
+func projectile_impact_engine_is_configurable(engine:SpellEngine) -> Dictionary:
+	# impact spells run on the engine given to the server; a freed engine falls back to the default
+	var server = ProjectileServer.get_singleton()
+	var previous = server.get_impact_engine()
+	var custom = SpellEngine.new()
+	server.set_impact_engine(custom)
+	var set_ok = server.get_impact_engine() == custom
+	custom.free()
+	var freed_ok = server.get_impact_engine() == null
+	server.set_impact_engine(previous)
+	if set_ok and freed_ok:
+		return {"ok": true}
+	return {"ok": false, "set": set_ok, "freed": freed_ok}
+
+func multimesh_batches_summons_and_projectiles(engine:SpellEngine) -> Dictionary:
+	# summons with multimesh and meshed projectiles are drawn through one batch per mesh
+	var batcher = MultiMeshBatcher.get_singleton()
+	var mesh = BoxMesh.new()
+	var proto = Node3D.new()
+	var mi = MeshInstance3D.new()
+	mi.mesh = mesh
+	proto.add_child(mi)
+	mi.owner = proto
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.free()
+	var caster = Node3D.new()
+	add_child(caster)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("summon_scene_v1")
+	comp.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 3, "multimesh": true})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	engine.execute_spell(spell, ctx)
+	var spawned = ctx.get_results().get("spawned_instances", [])
+	var server = ProjectileServer.get_singleton()
+	server.clear()
+	var shot_mesh = SphereMesh.new()
+	server.spawn(Vector3.ZERO, Vector3(0, 0, -5), 1.0, 0.0, Vector3.ZERO, 0, null, null, {}, shot_mesh)
+	server.spawn(Vector3.ZERO, Vector3(5, 0, 0), 1.0, 0.0, Vector3.ZERO, 0, null, null, {}, shot_mesh)
+	server.advance(0.1)
+	batcher.flush()
+	var summon_count = batcher.get_visible_count(mesh)
+	var shot_count = batcher.get_visible_count(shot_mesh)
+	var hidden = spawned.size() == 3
+	for inst in spawned:
+		hidden = hidden and not inst.get_child(0).visible
+	server.clear()
+	batcher.flush()
+	var shots_after_clear = batcher.get_visible_count(shot_mesh)
+	batcher.clear()
+	for inst in spawned:
+		inst.queue_free()
+	caster.queue_free()
+	if summon_count == 3 and shot_count == 2 and hidden and shots_after_clear == 0:
+		return {"ok": true}
+	return {"ok": false, "summons": summon_count, "shots": shot_count, "hidden": hidden, "after_clear": shots_after_clear}
+
+func force_activates_inert_bodies(engine:SpellEngine) -> Dictionary:
+	# summoned rigid bodies are parked frozen until force_v1 activates them; a pushed body is
+	# always unfrozen, even one authored with freeze = true, like any other frozen body
+	var proto = RigidBody3D.new()
+	var shape = CollisionShape3D.new()
+	shape.shape = SphereShape3D.new()
+	proto.add_child(shape)
+	shape.owner = proto
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.freeze = true
+	var frozen_scene = PackedScene.new()
+	frozen_scene.pack(proto)
+	proto.free()
+	var caster = Node3D.new()
+	add_child(caster)
+	var summon = SpellComponent.new()
+	summon.set_executor_id("summon_scene_v1")
+	summon.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 3})
+	var frozen_summon = SpellComponent.new()
+	frozen_summon.set_executor_id("summon_scene_v1")
+	frozen_summon.set_base_params({"scene": frozen_scene})
+	var spell = Spell.new()
+	spell.set_components([summon, frozen_summon])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	engine.execute_spell(spell, ctx)
+	var bodies = ctx.get_results().get("spawned_instances", [])
+	var parked = bodies.size() == 4
+	for b in bodies:
+		parked = parked and engine.is_spell_inert(b) and b.freeze \
+			and PhysicsServer3D.body_get_mode(b.get_rid()) == PhysicsServer3D.BODY_MODE_STATIC
+	# editing other body properties while parked must not wake the body
+	if bodies.size() > 0:
+		bodies[0].lock_rotation = true
+		parked = parked and PhysicsServer3D.body_get_mode(bodies[0].get_rid()) == PhysicsServer3D.BODY_MODE_STATIC
+	var force = SpellComponent.new()
+	force.set_executor_id("force_v1")
+	force.set_base_params({"force": Vector3(0, 3, 0)})
+	var push = Spell.new()
+	push.set_components([force])
+	engine.execute_spell(push, ctx)
+	var active = bodies.size() == 4
+	for i in range(bodies.size()):
+		var b = bodies[i]
+		var mode = PhysicsServer3D.BODY_MODE_RIGID_LINEAR if i == 0 else PhysicsServer3D.BODY_MODE_RIGID
+		active = active and not engine.is_spell_inert(b) and not b.freeze \
+			and PhysicsServer3D.body_get_mode(b.get_rid()) == mode
+		b.queue_free()
+	caster.queue_free()
+	if parked and active:
+		return {"ok": true}
+	return {"ok": false, "parked": parked, "active": active}
+
+func damage_meta_per_target(engine:SpellEngine) -> Dictionary:
+	# every target receives its own metadata copy; editing one must not leak into another
+	var caster = SpellCaster.new()
+	caster.set_mana("earth", 100.0)
+	add_child(caster)
+	var a = preload("res://demo/scripts/DemoTarget.gd").new()
+	var b = preload("res://demo/scripts/DemoTarget.gd").new()
+	add_child(a)
+	add_child(b)
+	var comp = SpellComponent.new()
+	comp.set_executor_id("damage_v1")
+	comp.set_base_params({"amount": 1})
+	comp.set_aspects_contributions({"earth": 1})
+	var spell = Spell.new()
+	spell.set_components([comp])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	ctx.set_targets([a, b])
+	engine.execute_spell(spell, ctx)
+	var ok = a.damage_log.size() == 1 and b.damage_log.size() == 1
+	if ok:
+		a.damage_log[0]["meta"]["tagged_by"] = "a"
+		ok = not b.damage_log[0]["meta"].has("tagged_by")
+	caster.queue_free()
+	a.queue_free()
+	b.queue_free()
+	if ok:
+		return {"ok": true}
+	return {"ok": false, "a": a.damage_log, "b": b.damage_log}
+
+func queued_summon_defers_later_components(engine:SpellEngine) -> Dictionary:
+	# components after a time-sliced summon run once its instances exist, and a cancelled
+	# group refunds the extra-spawn mana of the instances it never spawned
+	var queue = SummonSpawnQueue.get_singleton()
+	var old_budget = queue.get_instances_per_frame()
+	var proto = RigidBody3D.new()
+	var shape = CollisionShape3D.new()
+	shape.shape = SphereShape3D.new()
+	proto.add_child(shape)
+	shape.owner = proto
+	var scene = PackedScene.new()
+	scene.pack(proto)
+	proto.free()
+	var caster = Node3D.new()
+	add_child(caster)
+	var summon = SpellComponent.new()
+	summon.set_executor_id("summon_scene_v1")
+	summon.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 3, "time_sliced": true})
+	var force = SpellComponent.new()
+	force.set_executor_id("force_v1")
+	force.set_base_params({"force": Vector3(0, 3, 0)})
+	var spell = Spell.new()
+	spell.set_components([summon, force])
+	var ctx = SpellContext.new()
+	ctx.set_caster(caster)
+	engine.execute_spell(spell, ctx)
+	var queued = ctx.get_results().get("spawned_instances", []).size()
+	queue.flush()
+	var bodies = ctx.get_results().get("spawned_instances", [])
+	var active = bodies.size() == 3
+	for b in bodies:
+		active = active and not engine.is_spell_inert(b)
+		b.queue_free()
+	caster.queue_free()
+
+	var mage = SpellCaster.new()
+	mage.set_assigned_aspects(["fire"])
+	mage.set_mana("fire", 100.0)
+	add_child(mage)
+	var paid = SpellComponent.new()
+	paid.set_executor_id("summon_scene_v1")
+	paid.set_cost(1.0)
+	paid.set_base_params({"scene": scene, "pattern_type": "linear", "pattern_count": 5, "time_sliced": true})
+	var paid_spell = Spell.new()
+	paid_spell.set_components([paid])
+	var paid_ctx = SpellContext.new()
+	paid_ctx.set_caster(mage)
+	queue.set_instances_per_frame(2)
+	engine.execute_spell(paid_spell, paid_ctx)
+	var after_cast = mage.get_mana("fire")
+	queue.advance()
+	var group_id = paid_ctx.get_results().get("spawn_groups", {}).keys()[0]
+	queue.cancel_group(group_id)
+	queue.set_instances_per_frame(old_budget)
+	var refunded = mage.get_mana("fire") - after_cast
+	var partial = paid_ctx.get_results().get("spawned_instances", [])
+	for inst in partial:
+		inst.queue_free()
+	mage.queue_free()
+	# the cast paid one unit through the engine and four extra units up front; three never spawned
+	var unit = (100.0 - after_cast) / 5.0
+	if queued == 0 and active and unit > 0.0 and partial.size() == 2 and approx_equal(refunded, 3.0 * unit, 1e-6):
+		return {"ok": true}
+	return {"ok": false, "queued": queued, "active": active, "after_cast": after_cast, "spawned": partial.size(), "refunded": refunded}
 
 # Helper to run a single scenario (top-level to avoid nested lambdas issues)
 @warning_ignore("shadowed_variable_base_class")
@@ -284,6 +1232,118 @@ func run_all_tests() -> Dictionary:
 	var cb_nc = Callable(self, "no_contribs_uses_first_aspect").bind(engine_nc)
 	run_case(results, "no_contribs_first_aspect", cb_nc)
 
+	# 5b) Compiled plans are cached per spell and rebuilt when components change
+	var engine_plan = SpellEngine.new()
+	var cb_plan = Callable(self, "compiled_plan_reused").bind(engine_plan)
+	run_case(results, "compiled_plan_reused", cb_plan)
+
+	# 5c) Resolution cache hits on repeat and invalidates on caster scaler changes
+	var engine_cache = SpellEngine.new()
+	var cb_cache = Callable(self, "resolution_cache_invalidation").bind(engine_cache)
+	run_case(results, "resolution_cache_invalidation", cb_cache)
+	var engine_lru = SpellEngine.new()
+	var cb_lru = Callable(self, "resolution_cache_evicts_lru").bind(engine_lru)
+	run_case(results, "resolution_cache_evicts_lru", cb_lru)
+	var engine_aks = SpellEngine.new()
+	var cb_aks = Callable(self, "aspect_keys_keep_authored_spelling").bind(engine_aks)
+	run_case(results, "aspect_keys_keep_authored_spelling", cb_aks)
+	var engine_sid = SpellEngine.new()
+	var cb_sid = Callable(self, "synergy_ids_ignore_unrelated_aspects").bind(engine_sid)
+	run_case(results, "synergy_ids_ignore_unrelated_aspects", cb_sid)
+	var engine_sov = SpellEngine.new()
+	var cb_sov = Callable(self, "synergy_overflow_matches_index").bind(engine_sov)
+	run_case(results, "synergy_overflow_matches_index", cb_sov)
+
+	# 5d) Batch casts report a status per entry
+	var engine_batch = SpellEngine.new()
+	var cb_batch = Callable(self, "batch_cast_statuses").bind(engine_batch)
+	run_case(results, "batch_cast_statuses", cb_batch)
+
+	# 5e) Parallel planner cost evaluation matches the serial path
+	var engine_par = SpellEngine.new()
+	var cb_par = Callable(self, "parallel_mana_costs_match").bind(engine_par)
+	run_case(results, "parallel_mana_costs_match", cb_par)
+
+	var engine_cs = SpellEngine.new()
+	var cb_cs = Callable(self, "caster_storage_roundtrip").bind(engine_cs)
+	run_case(results, "caster_storage_roundtrip", cb_cs)
+
+	var engine_np = SpellEngine.new()
+	var cb_np = Callable(self, "native_params_reach_executor").bind(engine_np)
+	run_case(results, "native_params_reach_executor", cb_np)
+
+	var engine_sc = SpellEngine.new()
+	var cb_sc = Callable(self, "executor_schemas_generated").bind(engine_sc)
+	run_case(results, "executor_schemas_generated", cb_sc)
+
+	var engine_log = SpellEngine.new()
+	var cb_log = Callable(self, "log_channels_filter_and_buffer").bind(engine_log)
+	run_case(results, "log_channels_filter_and_buffer", cb_log)
+
+	var engine_tr = SpellEngine.new()
+	var cb_tr = Callable(self, "trace_dump_has_cast_spans").bind(engine_tr)
+	run_case(results, "trace_dump_has_cast_spans", cb_tr)
+	var engine_st = SpellEngine.new()
+	var cb_st = Callable(self, "stats_count_casts").bind(engine_st)
+	run_case(results, "stats_count_casts", cb_st)
+	var engine_ses = SpellEngine.new()
+	var cb_ses = Callable(self, "status_effect_server_ticks").bind(engine_ses)
+	run_case(results, "status_effect_server_ticks", cb_ses)
+	var engine_dsp = SpellEngine.new()
+	var cb_dsp = Callable(self, "dot_stack_policies").bind(engine_dsp)
+	run_case(results, "dot_stack_policies", cb_dsp)
+	var engine_dbo = SpellEngine.new()
+	var cb_dbo = Callable(self, "damage_batch_orders_all_targets").bind(engine_dbo)
+	run_case(results, "damage_batch_orders_all_targets", cb_dbo)
+	var engine_dst = SpellEngine.new()
+	var cb_dst = Callable(self, "dot_stack_tick_timing").bind(engine_dst)
+	run_case(results, "dot_stack_tick_timing", cb_dst)
+	var engine_dbt = SpellEngine.new()
+	var cb_dbt = Callable(self, "damage_batched_per_target").bind(engine_dbt)
+	run_case(results, "damage_batched_per_target", cb_dbt)
+	var engine_tc = SpellEngine.new()
+	var cb_tc = Callable(self, "target_capabilities_follow_script").bind(engine_tc)
+	run_case(results, "target_capabilities_follow_script", cb_tc)
+	var engine_sth = SpellEngine.new()
+	var cb_sth = Callable(self, "spell_target_native_hits").bind(engine_sth)
+	run_case(results, "spell_target_native_hits", cb_sth)
+	var engine_spr = SpellEngine.new()
+	var cb_spr = Callable(self, "scene_pool_reuses_instances").bind(engine_spr)
+	run_case(results, "scene_pool_reuses_instances", cb_spr)
+	var engine_scp = SpellEngine.new()
+	var cb_scp = Callable(self, "scene_cache_preloads_summon_scene").bind(engine_scp)
+	run_case(results, "scene_cache_preloads_summon_scene", cb_scp)
+	var engine_sts = SpellEngine.new()
+	var cb_sts = Callable(self, "summon_time_sliced_spawns").bind(engine_sts)
+	run_case(results, "summon_time_sliced_spawns", cb_sts)
+	var engine_sai = SpellEngine.new()
+	var cb_sai = Callable(self, "summon_async_instantiate").bind(engine_sai)
+	run_case(results, "summon_async_instantiate", cb_sai)
+	var engine_cda = SpellEngine.new()
+	var cb_cda = Callable(self, "cast_during_async_target_build").bind(engine_cda)
+	run_case(results, "cast_during_async_target_build", cb_cda)
+	var engine_psi = SpellEngine.new()
+	var cb_psi = Callable(self, "projectile_server_integrates").bind(engine_psi)
+	run_case(results, "projectile_server_integrates", cb_psi)
+	var engine_mmb = SpellEngine.new()
+	var cb_mmb = Callable(self, "multimesh_batches_summons_and_projectiles").bind(engine_mmb)
+	run_case(results, "multimesh_batches_summons_and_projectiles", cb_mmb)
+	var engine_fai = SpellEngine.new()
+	var cb_fai = Callable(self, "force_activates_inert_bodies").bind(engine_fai)
+	run_case(results, "force_activates_inert_bodies", cb_fai)
+	var engine_dmt = SpellEngine.new()
+	var cb_dmt = Callable(self, "damage_meta_per_target").bind(engine_dmt)
+	run_case(results, "damage_meta_per_target", cb_dmt)
+	var engine_qsd = SpellEngine.new()
+	var cb_qsd = Callable(self, "queued_summon_defers_later_components").bind(engine_qsd)
+	run_case(results, "queued_summon_defers_later_components", cb_qsd)
+	var engine_plc = SpellEngine.new()
+	var cb_plc = Callable(self, "projectile_launches_from_caster_body").bind(engine_plc)
+	run_case(results, "projectile_launches_from_caster_body", cb_plc)
+	var engine_pie = SpellEngine.new()
+	var cb_pie = Callable(self, "projectile_impact_engine_is_configurable").bind(engine_pie)
+	run_case(results, "projectile_impact_engine_is_configurable", cb_pie)
+
 	# 6) Fire synergy: extra executor (DOT) should be invoked and charge extra mana
 	var engine_fire = SpellEngine.new()
 	var cb_fire = Callable(self, "fire_synergy_extra_executor").bind(engine_fire)